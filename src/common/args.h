@@ -6,19 +6,46 @@
 #ifndef ARGS_H
 #define ARGS_H
 
+#include "common/inline.h"
 #include "common/types.h"
 
 /** @brief Type definition for an element in a variadic argument list. */
 typedef u64 arg_t;
 
+/**
+ * @brief Type and instance definitions for the type tag of an element in a
+ * typed variadic argument list (see TYPED_ARGS).
+ */
+typedef enum
+{
+    ARG_TYPE_INTEGER /** @brief Integer, character, boolean, or address. */
+,   ARG_TYPE_F64     /** @brief Floating point number (f32 or f64), by value. */
+}
+ARG_TYPE;
+
 /** @brief Type definition for a variadic argument list. */
 typedef struct
 {
-    u64     arg_count;
-    arg_t*  args;
+    u64         arg_count;
+    arg_t*      args;
+
+    // One ARG_TYPE tag per argument, or 0 if the list is untyped (see ARGS and
+    // TYPED_ARGS).
+    const u8*   types;
 }
 args_t;
 
+/**
+ * @brief Make ARGS an alias for TYPED_ARGS? Y/N (see TYPED_ARGS). Define
+ * before including this header (or on the command line) to override.
+ * 
+ * Note that a floating point argument is then no longer truncated to an
+ * integer when passed where an integer is expected.
+ */
+#ifndef ARGS_TYPED
+    #define ARGS_TYPED 0
+#endif
+
 /**
  * @brief Preprocessor binding to pass a variable number of arguments to a
  * function using the __VA_ARGS__ preprocessor directive.
@@ -34,7 +61,7 @@ args_t;
  * 
  * Currently doesn't support f32, and f64 must be passed by address, not value;
  * this is due to C's implicit flooring behavior when casting float types to int
- * types.
+ * types. For an argument list which passes both by value, see TYPED_ARGS.
  * 
  * String literals must be passed by address, not value.
  *
@@ -49,10 +76,106 @@ args_t;
  *  |          REENABLE_WARNING ()                                \
  *  |      })
  */
+#if ARGS_TYPED == 1
+#define ARGS(...) \
+    TYPED_ARGS ( __VA_ARGS__ )
+#else
 #define ARGS(...)                                                   \
     (( args_t ){ .arg_count = sizeof ( ( arg_t[] ){ __VA_ARGS__ } ) \
                             / sizeof ( arg_t )                      \
                , .args = ( arg_t[] ){ __VA_ARGS__ }                 \
                })
+#endif
+
+/**
+ * @brief Typed alternative to ARGS.
+ * 
+ * Selects an encoding for each argument at compile time (via _Generic) and
+ * records its type in a parallel array of ARG_TYPE tags. Floating point
+ * arguments (f32 and f64) are passed by value; f32 is widened to f64 without
+ * loss. Integers, characters, booleans, and addresses are encoded exactly as by
+ * ARGS. Since every conversion is explicit, this does not trip the compiler
+ * warning -Wint-conversion. A function which accepts an args_t also accepts
+ * this argument list; args.types is 0 for one built by ARGS.
+ * 
+ * Floating point arguments may still be passed by address; the address is
+ * tagged ARG_TYPE_INTEGER, so the receiving function can tell the two apart.
+ * 
+ * To make ARGS an alias for TYPED_ARGS, see ARGS_TYPED.
+ * 
+ * LIMITATIONS :
+ * 
+ * Supports at most 256 arguments. An argument which contains a comma outside
+ * of parentheses (e.g. a compound literal) must be wrapped in parentheses.
+ * 
+ * EXAMPLE USAGE :
+ * 
+ *  |  f32 f = 1.5f;
+ *  |  _my_function ( 1 , 2 , TYPED_ARGS ( f , 2.5 , "text" ) );
+ */
+#define TYPED_ARGS(...)                                                          \
+    (( args_t ){ .arg_count = sizeof ( ( const u8[] ){ _ARGS_MAP ( _ARG_TYPE , __VA_ARGS__ ) } ) \
+               , .args = ( arg_t[] ){ _ARGS_MAP ( _ARG_VALUE , __VA_ARGS__ ) }   \
+               , .types = ( const u8[] ){ _ARGS_MAP ( _ARG_TYPE , __VA_ARGS__ ) } \
+               })
+
+/**
+ * @brief Reinterprets the bits of a 64-bit floating point number as an element
+ * in a variadic argument list (see TYPED_ARGS).
+ * 
+ * @param value A 64-bit floating point number.
+ * @return value, bit-for-bit.
+ */
+INLINE
+arg_t
+_arg_f64
+(   const f64 value
+)
+{
+    union
+    {
+        f64     f;
+        arg_t   u;
+    }
+    bits = { .f = value };
+    return bits.u;
+}
+
+// Encodes a single argument (see TYPED_ARGS). Each inner _Generic expression
+// passes the argument through only to the branch which matches its type, so
+// every branch compiles without an implicit conversion.
+#define _ARG_VALUE(x)                                                      \
+    _Generic ( (x)                                                         \
+             , f64     : _arg_f64 ( _ARG_FLOAT ( x ) )                     \
+             , f32     : _arg_f64 ( _ARG_FLOAT ( x ) )                     \
+             , default : ( arg_t )( _Generic ( (x)                         \
+                                             , f64     : 0                 \
+                                             , f32     : 0                 \
+                                             , default : (x)               \
+                                             ))                            \
+             )
+#define _ARG_FLOAT(x)                                                      \
+    _Generic ( (x) , f64 : (x) , f32 : (x) , default : 0.0 )
+
+// Selects the type tag for a single argument (see TYPED_ARGS).
+#define _ARG_TYPE(x)                     \
+    _Generic ( (x)                       \
+             , f64     : ARG_TYPE_F64     \
+             , f32     : ARG_TYPE_F64     \
+             , default : ARG_TYPE_INTEGER \
+             )
+
+// Applies f to each argument, separating the results by commas (see
+// TYPED_ARGS). Each rescan pass of _ARGS_EXPAND expands one more argument.
+#define _ARGS_MAP(f,...) \
+    __VA_OPT__ ( _ARGS_EXPAND ( _ARGS_MAP_NEXT ( f , __VA_ARGS__ ) ) )
+#define _ARGS_MAP_NEXT(f,x,...) \
+    f ( x ) __VA_OPT__ ( , _ARGS_MAP_AGAIN _ARGS_MAP_PARENS ( f , __VA_ARGS__ ) )
+#define _ARGS_MAP_AGAIN() _ARGS_MAP_NEXT
+#define _ARGS_MAP_PARENS ()
+#define _ARGS_EXPAND(...)  _ARGS_EXPAND3 ( _ARGS_EXPAND3 ( _ARGS_EXPAND3 ( _ARGS_EXPAND3 ( __VA_ARGS__ ) ) ) )
+#define _ARGS_EXPAND3(...) _ARGS_EXPAND2 ( _ARGS_EXPAND2 ( _ARGS_EXPAND2 ( _ARGS_EXPAND2 ( __VA_ARGS__ ) ) ) )
+#define _ARGS_EXPAND2(...) _ARGS_EXPAND1 ( _ARGS_EXPAND1 ( _ARGS_EXPAND1 ( _ARGS_EXPAND1 ( __VA_ARGS__ ) ) ) )
+#define _ARGS_EXPAND1(...) __VA_ARGS__
 
 #endif  // ARGS_H
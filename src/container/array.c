@@ -21,14 +21,74 @@ _array_create
         if ( !stride )           LOGERROR ( "_array_create: Value of stride argument must be non-zero." );
         return 0;
     }
-    const u64 header_size = ARRAY_FIELD_COUNT * sizeof ( u64 );
     const u64 content_size = initial_capacity * stride;
-    const u64 size = header_size + content_size;
+    const u64 size = ARRAY_HEADER_SIZE + content_size;
     u64* array = memory_allocate ( size /* , MEMORY_TAG_ARRAY */ );
     memory_clear ( array , size );
     array[ ARRAY_FIELD_CAPACITY ] = initial_capacity;
     array[ ARRAY_FIELD_LENGTH ]   = 0;
     array[ ARRAY_FIELD_STRIDE ]   = stride;
+    array[ ARRAY_FIELD_FLAGS ]    = 0;
+    array[ ARRAY_FIELD_ARENA ]    = 0;
+    return array + ARRAY_FIELD_COUNT;
+}
+
+array_t*
+_array_create_in_arena
+(   memory_arena_t* arena
+,   ARRAY_FIELD     initial_capacity
+,   ARRAY_FIELD     stride
+)
+{
+    if ( !arena || !initial_capacity || !stride )
+    {
+        if ( !arena )            LOGERROR ( "_array_create_in_arena: Missing argument: arena." );
+        if ( !initial_capacity ) LOGERROR ( "_array_create_in_arena: Value of initial_capacity argument must be non-zero." );
+        if ( !stride )           LOGERROR ( "_array_create_in_arena: Value of stride argument must be non-zero." );
+        return 0;
+    }
+    const u64 content_size = initial_capacity * stride;
+    const u64 size = ARRAY_HEADER_SIZE + content_size;
+    u64* array = memory_arena_allocate ( arena , size );
+    if ( !array )
+    {
+        LOGERROR ( "_array_create_in_arena: Failed to allocate %u bytes from arena." , size );
+        return 0;
+    }
+    memory_clear ( array , size );
+    array[ ARRAY_FIELD_CAPACITY ] = initial_capacity;
+    array[ ARRAY_FIELD_LENGTH ]   = 0;
+    array[ ARRAY_FIELD_STRIDE ]   = stride;
+    array[ ARRAY_FIELD_FLAGS ]    = 0;
+    array[ ARRAY_FIELD_ARENA ]    = ( u64 ) arena;
+    return array + ARRAY_FIELD_COUNT;
+}
+
+array_t*
+_array_create_in
+(   void*       buffer
+,   u64         buffer_size
+,   ARRAY_FIELD stride
+)
+{
+    if ( !buffer || !stride || buffer_size < ARRAY_HEADER_SIZE + stride )
+    {
+        if ( !buffer ) LOGERROR ( "_array_create_in: Missing argument: buffer." );
+        if ( !stride ) LOGERROR ( "_array_create_in: Value of stride argument must be non-zero." );
+        else if ( buffer_size < ARRAY_HEADER_SIZE + stride )
+        {
+            LOGERROR ( "_array_create_in: Value of buffer_size argument is too small (%u bytes); at least %u bytes are required."
+                     , buffer_size , ARRAY_HEADER_SIZE + stride
+                     );
+        }
+        return 0;
+    }
+    u64* array = buffer;
+    array[ ARRAY_FIELD_CAPACITY ] = ( buffer_size - ARRAY_HEADER_SIZE ) / stride;
+    array[ ARRAY_FIELD_LENGTH ]   = 0;
+    array[ ARRAY_FIELD_STRIDE ]   = stride;
+    array[ ARRAY_FIELD_FLAGS ]    = ARRAY_FLAG_BORROWED;
+    array[ ARRAY_FIELD_ARENA ]    = 0;
     return array + ARRAY_FIELD_COUNT;
 }
 
@@ -37,7 +97,10 @@ _array_destroy
 (   array_t* array
 )
 {
-    if ( !array )
+    if (   !array
+        || array_flags ( array ) & ARRAY_FLAG_BORROWED
+        || _array_field_get ( array , ARRAY_FIELD_ARENA )
+       )
     {
         return;
     }
@@ -101,11 +164,10 @@ _array_size
 )
 {
     u64* header = ( ( u64* ) array ) - ARRAY_FIELD_COUNT;
-    const u64 header_size = ARRAY_FIELD_COUNT * sizeof ( u64 );
     const u64 content_size = header[ ARRAY_FIELD_STRIDE ]
                            * header[ ARRAY_FIELD_CAPACITY ]
                            ;
-    return header_size + content_size;
+    return ARRAY_HEADER_SIZE + content_size;
 }
 
 array_t*
@@ -120,7 +182,10 @@ _array_resize
     }
     const u64 length = MIN ( array_length ( old_array ) , minimum_capacity );
     const u64 stride = array_stride ( old_array );
-    void* new_array = _array_create ( minimum_capacity , stride );
+    memory_arena_t* arena = ( memory_arena_t* ) _array_field_get ( old_array , ARRAY_FIELD_ARENA );
+    void* new_array = ( arena ) ? _array_create_in_arena ( arena , minimum_capacity , stride )
+                                : _array_create ( minimum_capacity , stride )
+                                ;
     memory_copy ( new_array , old_array , length * stride );
     _array_field_set ( new_array , ARRAY_FIELD_LENGTH , length );
     _array_destroy ( old_array );
@@ -6,6 +6,7 @@
 #define ARRAY_H
 
 #include "core/array.h"
+#include "platform/memory.h"
 
 /** @brief Type declaration for a resizable array. */
 typedef void array_t;
@@ -16,11 +17,29 @@ typedef enum
     ARRAY_FIELD_CAPACITY
 ,   ARRAY_FIELD_LENGTH
 ,   ARRAY_FIELD_STRIDE
+,   ARRAY_FIELD_FLAGS
+,   ARRAY_FIELD_ARENA
 
 ,   ARRAY_FIELD_COUNT
 }
 ARRAY_FIELD;
 
+/** @brief Type and instance definitions for array flags. */
+typedef enum
+{
+    /**
+     * @brief The array is stored in memory it does not own (see
+     * _array_create_in). array_destroy does not free it, and resizing copies
+     * it to a new heap allocation, leaving the original memory untouched.
+     */
+    ARRAY_FLAG_BORROWED = 1 << 0
+}
+ARRAY_FLAG;
+
+/** @brief Number of bytes in a resizable array header. */
+#define ARRAY_HEADER_SIZE \
+    ( ARRAY_FIELD_COUNT * sizeof ( u64 ) )
+
 /** @brief Array default capacity. */
 #define ARRAY_DEFAULT_CAPACITY 10
 
@@ -53,6 +72,53 @@ _array_create
 #define array_create_new(type) \
     _array_create ( ARRAY_DEFAULT_CAPACITY , sizeof ( type ) )
 
+/**
+ * @brief Creates a resizable array inside an existing memory buffer, such as
+ * one on the stack. O(1).
+ * 
+ * No memory is allocated until the array grows beyond the capacity of the
+ * buffer, at which point it is moved to the heap. The array must not outlive
+ * the buffer. Call array_destroy as usual when finished with the array; it
+ * only frees memory if the array was moved to the heap.
+ * 
+ * @param buffer The memory to store the array in. Must be non-zero, and
+ * aligned to 8 bytes.
+ * @param buffer_size The size of buffer in bytes. Must be large enough to
+ * hold the array header (ARRAY_HEADER_SIZE) plus at least one element.
+ * @param stride The fixed element size in bytes. Must be non-zero.
+ * @return An empty resizable array.
+ */
+array_t*
+_array_create_in
+(   void*       buffer
+,   u64         buffer_size
+,   ARRAY_FIELD stride
+);
+
+/**
+ * @brief Allocates memory for a resizable array from an arena allocator (see
+ * platform/memory.h).
+ * 
+ * The array, and every resized copy of it, is allocated from the arena.
+ * array_destroy does not free it; the memory is released when the arena is
+ * reset or destroyed. The array must not be used after that.
+ * 
+ * @param arena The arena to allocate from. Must be non-zero.
+ * @param initial_capacity The initial capacity. Must be non-zero.
+ * @param stride The fixed element size in bytes. Must be non-zero.
+ * @return An empty resizable array, or 0 if the arena could not grow.
+ */
+array_t*
+_array_create_in_arena
+(   memory_arena_t* arena
+,   ARRAY_FIELD     initial_capacity
+,   ARRAY_FIELD     stride
+);
+
+/** @param type C data type of the array. */
+#define array_create_in_arena(type,arena,initial_capacity) \
+    _array_create_in_arena ( (arena) , (initial_capacity) , sizeof ( type ) )
+
 /**
  * @brief Creates a resizable array by copying an existing fixed-length array.
  * O(n).
@@ -113,6 +179,10 @@ _array_field_get
 #define array_stride(array) \
     _array_field_get ( (array) , ARRAY_FIELD_STRIDE )
 
+/** @brief Query array field: flags. */
+#define array_flags(array) \
+    _array_field_get ( (array) , ARRAY_FIELD_FLAGS )
+
 /**
  * @brief Sets the value of a resizable array field. O(1).
  * 
@@ -145,6 +215,10 @@ _array_size
 /**
  * @brief Resizes an existing resizable array. O(n).
  * 
+ * The resized array is allocated from the same arena as the original array if
+ * it has one (see _array_create_in_arena); otherwise, it is always stored on
+ * the heap, even if the original array was not (see _array_create_in).
+ * 
  * @param array The resizable array to resize. Must be non-zero.
  * @param minimum_capacity The minimum number of elements the new array is
  * required to hold. If the value of this parameter is less than the current
@@ -9,6 +9,50 @@
 #include "math/math.h"
 #include "platform/memory.h"
 
+/** @brief Number of values stringified per reservation (see __string_append_u64_array). */
+#define STRING_APPEND_ARRAY_BLOCK_LENGTH 256
+
+/** @brief Type definition for an Aho-Corasick automaton over a set of substrings (see __string_replace_multiple). */
+typedef struct
+{
+    u32*    next;           // Transition table; indexed by state * 256 + character.
+    u32*    depth;          // Length of the prefix each state represents.
+    u32*    match;          // 1 + index of the longest substring ending in each state; 0 if none.
+    u64     state_count;
+}
+string_replace_automaton_t;
+
+/**
+ * @brief Builds an Aho-Corasick automaton which recognizes a set of
+ * substrings. O(256 * m), where m is the total length of the substrings.
+ * 
+ * Uses dynamic memory allocation. Call _string_replace_automaton_destroy to
+ * free.
+ * 
+ * @param automaton Output buffer for the automaton. Must be non-zero.
+ * @param removes The substrings to recognize. Must be non-zero.
+ * @param remove_lengths The number of characters in each substring. Empty
+ * substrings are ignored. Must be non-zero.
+ * @param count The number of substrings.
+ */
+void
+_string_replace_automaton_create
+(   string_replace_automaton_t* automaton
+,   const char**                removes
+,   const u64*                  remove_lengths
+,   const u64                   count
+);
+
+/**
+ * @brief Frees the memory used by an Aho-Corasick automaton.
+ * 
+ * @param automaton The automaton to free. Must be non-zero.
+ */
+void
+_string_replace_automaton_destroy
+(   string_replace_automaton_t* automaton
+);
+
 string_t*
 __string_create
 (   ARRAY_FIELD initial_capacity
@@ -24,6 +68,37 @@ __string_create
     return string;//                                 ^ terminator
 }
 
+string_t*
+__string_create_in_arena
+(   memory_arena_t* arena
+,   ARRAY_FIELD     initial_capacity
+)
+{
+    char* string = array_create_in_arena ( char , arena , initial_capacity );
+    if ( !string )
+    {
+        return 0;
+    }
+    _array_field_set ( string , ARRAY_FIELD_LENGTH , 1 );
+    return string;//                                 ^ terminator
+}
+
+string_t*
+__string_create_in
+(   void*       buffer
+,   const u64   buffer_size
+)
+{
+    char* string = _array_create_in ( buffer , buffer_size , sizeof ( char ) );
+    if ( !string )
+    {
+        return 0;
+    }
+    *string = 0;
+    _array_field_set ( string , ARRAY_FIELD_LENGTH , 1 );
+    return string;//                                 ^ terminator
+}
+
 string_t*
 __string_copy
 (   const char* src
@@ -81,6 +156,131 @@ __string_append
     return string;
 }
 
+string_t*
+__string_append_u64_array
+(   string_t*   string
+,   const u64*  array
+,   const u64   array_length
+,   const u8    radix
+,   const char* separator
+,   const u64   separator_length
+)
+{
+    u64 length = string_length ( string );
+    for ( u64 i = 0; i < array_length; i += STRING_APPEND_ARRAY_BLOCK_LENGTH )
+    {
+        const u64 count = MIN ( array_length - i
+                              , ( u64 ) STRING_APPEND_ARRAY_BLOCK_LENGTH
+                              );
+        const u64 required = length + separator_length
+                           + count * ( STRING_INTEGER_MAX_LENGTH + separator_length )
+                           + 1
+                           ;
+        if ( required > array_capacity ( string ) )
+        {
+            string = array_resize ( string , required );
+        }
+        if ( i )
+        {
+            memory_copy ( string + length , separator , separator_length );
+            length += separator_length;
+        }
+        length += string_u64_array ( array + i
+                                  , count
+                                  , radix
+                                  , separator
+                                  , separator_length
+                                  , string + length
+                                  );
+        _array_field_set ( string , ARRAY_FIELD_LENGTH , length + 1 );
+    }
+    return string;
+}
+
+string_t*
+__string_append_i64_array
+(   string_t*   string
+,   const i64*  array
+,   const u64   array_length
+,   const u8    radix
+,   const char* separator
+,   const u64   separator_length
+)
+{
+    u64 length = string_length ( string );
+    for ( u64 i = 0; i < array_length; i += STRING_APPEND_ARRAY_BLOCK_LENGTH )
+    {
+        const u64 count = MIN ( array_length - i
+                              , ( u64 ) STRING_APPEND_ARRAY_BLOCK_LENGTH
+                              );
+        const u64 required = length + separator_length
+                           + count * ( STRING_INTEGER_MAX_LENGTH + separator_length )
+                           + 1
+                           ;
+        if ( required > array_capacity ( string ) )
+        {
+            string = array_resize ( string , required );
+        }
+        if ( i )
+        {
+            memory_copy ( string + length , separator , separator_length );
+            length += separator_length;
+        }
+        length += string_i64_array ( array + i
+                                  , count
+                                  , radix
+                                  , separator
+                                  , separator_length
+                                  , string + length
+                                  );
+        _array_field_set ( string , ARRAY_FIELD_LENGTH , length + 1 );
+    }
+    return string;
+}
+
+string_t*
+__string_append_f64_array
+(   string_t*   string
+,   const f64*  array
+,   const u64   array_length
+,   const u8    precision
+,   const bool  abbreviated
+,   const char* separator
+,   const u64   separator_length
+)
+{
+    u64 length = string_length ( string );
+    for ( u64 i = 0; i < array_length; i += STRING_APPEND_ARRAY_BLOCK_LENGTH )
+    {
+        const u64 count = MIN ( array_length - i
+                              , ( u64 ) STRING_APPEND_ARRAY_BLOCK_LENGTH
+                              );
+        const u64 required = length + separator_length
+                           + count * ( STRING_FLOAT_MAX_LENGTH + separator_length )
+                           + 1
+                           ;
+        if ( required > array_capacity ( string ) )
+        {
+            string = array_resize ( string , required );
+        }
+        if ( i )
+        {
+            memory_copy ( string + length , separator , separator_length );
+            length += separator_length;
+        }
+        length += string_f64_array ( array + i
+                                  , count
+                                  , precision
+                                  , abbreviated
+                                  , separator
+                                  , separator_length
+                                  , string + length
+                                  );
+        _array_field_set ( string , ARRAY_FIELD_LENGTH , length + 1 );
+    }
+    return string;
+}
+
 string_t*
 __string_prepend
 (   string_t*   string
@@ -245,26 +445,154 @@ __string_replace
     // CASE: Substring to remove and replacement substring differ in length.
     else
     {
+        const u64 old_length = string_length ( string );
+
+        // Count the matches in order to size the result once.
+        u64 count = 0;
         u64 index = 0;
         u64 index_;
         while ( string_contains ( string + index
-                                , string_length ( string ) - index
+                                , old_length - index
                                 , remove
                                 , remove_length
                                 , false
                                 , &index_
                                 ))
         {
-            index += index_;
-            string_remove ( string , index , remove_length );
-            string_insert ( string , index , replace , replace_length );
-            index += replace_length;
+            index += index_ + remove_length;
+            count += 1;
+        }
+        if ( !count )
+        {
+            return string;
         }
+        const u64 new_length = old_length
+                             - count * remove_length
+                             + count * replace_length
+                             ;
+
+        // If the result is longer, grow the string (once) and shift the
+        // original content to the end of it. Either way, the result can then
+        // be written front to back without overwriting any unread content.
+        u64 read = 0;
+        if ( new_length > old_length )
+        {
+            if ( new_length + 1 > array_capacity ( string ) )
+            {
+                string = _array_resize ( string , new_length + 1 );
+            }
+            read = new_length - old_length;
+            memory_move ( string + read , string , old_length );
+        }
+        const u64 end = read + old_length;
+        u64 write = 0;
+        while ( string_contains ( string + read
+                                , end - read
+                                , remove
+                                , remove_length
+                                , false
+                                , &index_
+                                ))
+        {
+            memory_move ( string + write , string + read , index_ );
+            write += index_;
+            read += index_ + remove_length;
+            memory_copy ( string + write , replace , replace_length );
+            write += replace_length;
+        }
+        memory_move ( string + write , string + read , end - read );
+        string[ new_length ] = 0; // Append terminator.
+        _array_field_set ( string , ARRAY_FIELD_LENGTH , new_length + 1 );
     }
 
     return string;
 }
 
+string_t*
+__string_replace_multiple
+(   string_t*       string
+,   const char**    removes
+,   const u64*      remove_lengths
+,   const char**    replaces
+,   const u64*      replace_lengths
+,   const u64       count
+)
+{
+    if ( !count )
+    {
+        return string;
+    }
+
+    string_replace_automaton_t automaton;
+    _string_replace_automaton_create ( &automaton
+                                     , removes
+                                     , remove_lengths
+                                     , count
+                                     );
+
+    const u64 length = string_length ( string );
+    string_t* result = 0;
+    u64 copied = 0;
+    u64 i = 0;
+    while ( i < length )
+    {
+        // Scan for the leftmost match (the longest one, if several start at
+        // the same index). It is final once no match starting at or before it
+        // can still be in progress, i.e. once the prefix tracked by the
+        // automaton starts after it.
+        u32 state = 0;
+        u32 match = 0;
+        u64 match_start = 0;
+        for ( ; i < length; ++i )
+        {
+            state = automaton.next[ state * 256 + ( u8 )( string[ i ] ) ];
+            const u32 match_ = automaton.match[ state ];
+            if ( match_ )
+            {
+                const u64 match_start_ = i + 1 - remove_lengths[ match_ - 1 ];
+                if ( !match || match_start_ <= match_start )
+                {
+                    match = match_;
+                    match_start = match_start_;
+                }
+            }
+            if ( match && i + 1 - automaton.depth[ state ] > match_start )
+            {
+                break;
+            }
+        }
+        if ( !match )
+        {
+            break;
+        }
+
+        // Copy everything up to the match, then the replacement, and resume
+        // scanning after the match.
+        if ( !result )
+        {
+            result = _string_create ( length + 1 );
+        }
+        string_append ( result , string + copied , match_start - copied );
+        string_append ( result , replaces[ match - 1 ] , replace_lengths[ match - 1 ] );
+        copied = match_start + remove_lengths[ match - 1 ];
+        i = copied;
+    }
+
+    _string_replace_automaton_destroy ( &automaton );
+
+    // CASE: No matches.
+    if ( !result )
+    {
+        return string;
+    }
+
+    string_append ( result , string + copied , length - copied );
+    string_clear ( string );
+    string_append ( string , result , string_length ( result ) );
+    string_destroy ( result );
+    return string;
+}
+
 string_t*
 __string_trim
 (   string_t* string
@@ -381,4 +709,100 @@ __string_strip_ansi
     }
 
     return string;
+}
+
+void
+_string_replace_automaton_create
+(   string_replace_automaton_t* automaton
+,   const char**                removes
+,   const u64*                  remove_lengths
+,   const u64                   count
+)
+{
+    u64 capacity = 1;
+    for ( u64 i = 0; i < count; ++i )
+    {
+        capacity += remove_lengths[ i ];
+    }
+    automaton->next = memory_allocate ( capacity * 256 * sizeof ( u32 ) );
+    automaton->depth = memory_allocate ( capacity * sizeof ( u32 ) );
+    automaton->match = memory_allocate ( capacity * sizeof ( u32 ) );
+    automaton->state_count = 1;
+
+    // Build the trie. State 0 is the root; since no trie edge leads back to
+    // the root, 0 doubles as "no edge" until the transitions are completed.
+    for ( u64 i = 0; i < count; ++i )
+    {
+        if ( !remove_lengths[ i ] )
+        {
+            continue;
+        }
+        u32 state = 0;
+        for ( u64 j = 0; j < remove_lengths[ i ]; ++j )
+        {
+            u32* next = &automaton->next[ state * 256 + ( u8 )( removes[ i ][ j ] ) ];
+            if ( !*next )
+            {
+                *next = automaton->state_count;
+                automaton->depth[ *next ] = j + 1;
+                automaton->state_count += 1;
+            }
+            state = *next;
+        }
+        if ( !automaton->match[ state ] ) // First duplicate wins.
+        {
+            automaton->match[ state ] = i + 1;
+        }
+    }
+
+    // Compute failure links breadth-first, completing the transition table
+    // along the way so that matching never has to follow them. Each state
+    // inherits the longest match of its failure state unless it ends a
+    // substring itself.
+    u32* fail = memory_allocate ( automaton->state_count * sizeof ( u32 ) );
+    u32* queue = memory_allocate ( automaton->state_count * sizeof ( u32 ) );
+    u64 queue_start = 0;
+    u64 queue_end = 0;
+    for ( u64 c = 0; c < 256; ++c )
+    {
+        const u32 next = automaton->next[ c ];
+        if ( next )
+        {
+            queue[ queue_end++ ] = next;
+        }
+    }
+    while ( queue_start < queue_end )
+    {
+        const u32 state = queue[ queue_start++ ];
+        u32* next = &automaton->next[ state * 256 ];
+        const u32* next_fail = &automaton->next[ fail[ state ] * 256 ];
+        for ( u64 c = 0; c < 256; ++c )
+        {
+            if ( next[ c ] )
+            {
+                fail[ next[ c ] ] = next_fail[ c ];
+                if ( !automaton->match[ next[ c ] ] )
+                {
+                    automaton->match[ next[ c ] ] = automaton->match[ next_fail[ c ] ];
+                }
+                queue[ queue_end++ ] = next[ c ];
+            }
+            else
+            {
+                next[ c ] = next_fail[ c ];
+            }
+        }
+    }
+    memory_free ( fail );
+    memory_free ( queue );
+}
+
+void
+_string_replace_automaton_destroy
+(   string_replace_automaton_t* automaton
+)
+{
+    memory_free ( automaton->next );
+    memory_free ( automaton->depth );
+    memory_free ( automaton->match );
 }
\ No newline at end of file
@@ -37,6 +37,70 @@ __string_create
 #define _string_create(initial_capacity) \
     __string_create ( initial_capacity )
 
+/**
+ * @brief Allocates memory for a resizable string from an arena allocator (see
+ * platform/memory.h).
+ * 
+ * The string grows within the arena (see _array_create_in_arena), and all
+ * other string functions work on it unchanged. string_destroy does not free
+ * it; the memory is released with every other allocation from the arena when
+ * the arena is reset or destroyed.
+ * 
+ * Use _string_create_in_arena to explicitly specify initial capacity, or
+ * string_create_in_arena to use the default.
+ * 
+ * @param arena The arena to allocate from. Must be non-zero.
+ * @param initial_capacity The initial capacity for the string backend array.
+ * @return An empty resizable string with the specified backend array capacity.
+ */
+string_t*
+__string_create_in_arena
+(   memory_arena_t* arena
+,   ARRAY_FIELD     initial_capacity
+);
+
+#define string_create_in_arena(arena) \
+    __string_create_in_arena ( (arena) , STRING_DEFAULT_CAPACITY )
+
+#define _string_create_in_arena(arena,initial_capacity) \
+    __string_create_in_arena ( (arena) , (initial_capacity) )
+
+/** @brief Defines local resizable string capacity (see string_create_local). */
+#define STRING_LOCAL_CAPACITY 48
+
+/**
+ * @brief Creates a resizable string inside an existing memory buffer, such as
+ * one on the stack. O(1).
+ * 
+ * No memory is allocated until the string grows beyond the capacity of the
+ * buffer, at which point it moves to the heap (see _array_create_in). All
+ * other string functions work on it unchanged. Call string_destroy as usual;
+ * it only frees memory if the string moved to the heap.
+ * 
+ * Use string_create_local to create a string of STRING_LOCAL_CAPACITY
+ * characters (terminator included) in a buffer that lasts until the end of
+ * the enclosing block, or _string_create_in to supply the buffer explicitly.
+ * 
+ * @param buffer The memory to store the string in. Must be non-zero, and
+ * aligned to 8 bytes.
+ * @param buffer_size The size of buffer in bytes. Must exceed
+ * ARRAY_HEADER_SIZE.
+ * @return An empty resizable string stored in buffer.
+ */
+string_t*
+__string_create_in
+(   void*       buffer
+,   const u64   buffer_size
+);
+
+#define _string_create_in(buffer,buffer_size) \
+    __string_create_in ( (buffer) , (buffer_size) )
+
+#define string_create_local()                                                                     \
+    __string_create_in ( ( u64[ ARRAY_FIELD_COUNT + STRING_LOCAL_CAPACITY / sizeof ( u64 ) ] ){ 0 } \
+                       , ARRAY_HEADER_SIZE + STRING_LOCAL_CAPACITY                                  \
+                       )
+
 /**
  * @brief Creates a resizable copy of an existing string. O(n).
  * 
@@ -126,6 +190,130 @@ __string_append
                                    );                         \
     })
 
+/**
+ * @brief Appends a stringified array of 64-bit unsigned integers to a resizable string,
+ * separating the values by a separator string. O(n).
+ * 
+ * Values are written directly into the string by string_u64_array (see
+ * core/string.h); space is reserved once per block of values rather than once
+ * per value.
+ * 
+ * Use string_append_u64_array to append a resizable array (see
+ * container/array.h), or __string_append_u64_array to explicitly specify
+ * the array length.
+ * 
+ * @param string The resizable string to append to. Must be non-zero.
+ * @param array The values to append. Must be non-zero if array_length is
+ * non-zero.
+ * @param array_length The number of values.
+ * @param radix Integer radix in the range [2..36] (inclusive).
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @return The resizable string (possibly with new address).
+ */
+string_t*
+__string_append_u64_array
+(   string_t*   string
+,   const u64*  array
+,   const u64   array_length
+,   const u8    radix
+,   const char* separator
+,   const u64   separator_length
+);
+
+#define string_append_u64_array(string,array,radix,separator,separator_length) \
+    ( (string) = __string_append_u64_array ( (string)                    \
+                                            , (array)                     \
+                                            , array_length ( array )      \
+                                            , (radix)                     \
+                                            , (separator)                 \
+                                            , (separator_length)          \
+                                            ) )
+
+/**
+ * @brief Appends a stringified array of 64-bit signed integers to a resizable string,
+ * separating the values by a separator string. O(n).
+ * 
+ * Values are written directly into the string by string_i64_array (see
+ * core/string.h); space is reserved once per block of values rather than once
+ * per value.
+ * 
+ * Use string_append_i64_array to append a resizable array (see
+ * container/array.h), or __string_append_i64_array to explicitly specify
+ * the array length.
+ * 
+ * @param string The resizable string to append to. Must be non-zero.
+ * @param array The values to append. Must be non-zero if array_length is
+ * non-zero.
+ * @param array_length The number of values.
+ * @param radix Integer radix in the range [2..36] (inclusive).
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @return The resizable string (possibly with new address).
+ */
+string_t*
+__string_append_i64_array
+(   string_t*   string
+,   const i64*  array
+,   const u64   array_length
+,   const u8    radix
+,   const char* separator
+,   const u64   separator_length
+);
+
+#define string_append_i64_array(string,array,radix,separator,separator_length) \
+    ( (string) = __string_append_i64_array ( (string)                    \
+                                            , (array)                     \
+                                            , array_length ( array )      \
+                                            , (radix)                     \
+                                            , (separator)                 \
+                                            , (separator_length)          \
+                                            ) )
+
+/**
+ * @brief Appends a stringified array of 64-bit floating point numbers to a resizable string,
+ * separating the values by a separator string. O(n).
+ * 
+ * Values are written directly into the string by string_f64_array (see
+ * core/string.h); space is reserved once per block of values rather than once
+ * per value.
+ * 
+ * Use string_append_f64_array to append a resizable array (see
+ * container/array.h), or __string_append_f64_array to explicitly specify
+ * the array length.
+ * 
+ * @param string The resizable string to append to. Must be non-zero.
+ * @param array The values to append. Must be non-zero if array_length is
+ * non-zero.
+ * @param array_length The number of values.
+ * @param precision Floating point precision, or
+ * STRING_FLOAT_SHORTEST_PRECISION.
+ * @param abbreviated Use abbreviated (scientific) notation? Y/N
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @return The resizable string (possibly with new address).
+ */
+string_t*
+__string_append_f64_array
+(   string_t*   string
+,   const f64*  array
+,   const u64   array_length
+,   const u8    precision
+,   const bool  abbreviated
+,   const char* separator
+,   const u64   separator_length
+);
+
+#define string_append_f64_array(string,array,precision,abbreviated,separator,separator_length) \
+    ( (string) = __string_append_f64_array ( (string)                    \
+                                            , (array)                     \
+                                            , array_length ( array )      \
+                                            , (precision)                 \
+                                            , (abbreviated)               \
+                                            , (separator)                 \
+                                            , (separator_length)          \
+                                            ) )
+
 /**
  * @brief Prepends to a resizable string. O(n).
  * 
@@ -283,6 +471,52 @@ __string_replace
                                     );                             \
     })
 
+/**
+ * @brief Replaces every occurrence of any of a set of substrings within a
+ * resizable string in a single scan. O(n + 256 * m), where m is the total
+ * length of the substrings to remove.
+ * 
+ * The string is scanned from left to right with an Aho-Corasick automaton. At
+ * each step, the match starting furthest left is replaced (the longest one, if
+ * several start at the same index), and scanning resumes after it; matches
+ * never overlap. Replacements are never rescanned.
+ * 
+ * Use string_replace_multiple to replace a dictionary of tokens in a template,
+ * for instance, without a separate pass (and copy) per token.
+ * 
+ * @param string The resizable string to mutate. Must be non-zero.
+ * @param removes The substrings to remove. Empty substrings are ignored; if a
+ * substring occurs more than once, its first replacement is used. Must be
+ * non-zero if count is non-zero.
+ * @param remove_lengths The number of characters in each substring to remove.
+ * Must be non-zero if count is non-zero.
+ * @param replaces The substrings to replace each removed substring with. Must
+ * be non-zero if count is non-zero.
+ * @param replace_lengths The number of characters in each replacement
+ * substring. Must be non-zero if count is non-zero.
+ * @param count The number of substrings to remove.
+ * @return The resizable string with all matches replaced (possibly with new
+ * address).
+ */
+string_t*
+__string_replace_multiple
+(   string_t*       string
+,   const char**    removes
+,   const u64*      remove_lengths
+,   const char**    replaces
+,   const u64*      replace_lengths
+,   const u64       count
+);
+
+#define string_replace_multiple(string,removes,remove_lengths,replaces,replace_lengths,count) \
+    ( (string) = __string_replace_multiple ( (string)                                        \
+                                           , (removes)                                       \
+                                           , (remove_lengths)                                \
+                                           , (replaces)                                      \
+                                           , (replace_lengths)                               \
+                                           , (count)                                         \
+                                           ) )
+
 /**
  * @brief Trims whitespace off front and back of a string. O(n). In-place.
  *
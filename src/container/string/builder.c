@@ -0,0 +1,170 @@
+/**
+ * @file container/string/builder.c
+ * @brief Implementation of the container/string/builder header.
+ * (see container/string/builder.h for additional details)
+ */
+#include "container/string/builder.h"
+
+#include "container/string.h"
+#include "math/math.h"
+#include "platform/memory.h"
+
+/**
+ * @brief Allocates an empty chunk and links it onto the tail of a string
+ * builder.
+ * 
+ * @param builder The builder to extend. Must be non-zero.
+ * @return The new chunk.
+ */
+string_builder_chunk_t*
+_string_builder_chunk_create
+(   string_builder_t* builder
+);
+
+void
+string_builder_create
+(   string_builder_t*   builder
+,   const u64           chunk_capacity
+)
+{
+    builder->head = 0;
+    builder->tail = 0;
+    builder->length = 0;
+    builder->chunk_capacity = chunk_capacity ? chunk_capacity
+                                             : STRING_BUILDER_DEFAULT_CHUNK_CAPACITY
+                                             ;
+}
+
+void
+string_builder_destroy
+(   string_builder_t* builder
+)
+{
+    string_builder_chunk_t* chunk = builder->head;
+    while ( chunk )
+    {
+        string_builder_chunk_t* next = chunk->next;
+        memory_free ( chunk );
+        chunk = next;
+    }
+    builder->head = 0;
+    builder->tail = 0;
+    builder->length = 0;
+}
+
+void
+string_builder_clear
+(   string_builder_t* builder
+)
+{
+    if ( !builder->head )
+    {
+        return;
+    }
+    string_builder_chunk_t* chunk = builder->head->next;
+    while ( chunk )
+    {
+        string_builder_chunk_t* next = chunk->next;
+        memory_free ( chunk );
+        chunk = next;
+    }
+    builder->head->next = 0;
+    builder->head->length = 0;
+    builder->tail = builder->head;
+    builder->length = 0;
+}
+
+u64
+string_builder_length
+(   const string_builder_t* builder
+)
+{
+    return builder->length;
+}
+
+void
+__string_builder_append
+(   string_builder_t*   builder
+,   const char*         src
+,   const u64           src_length
+)
+{
+    u64 copied = 0;
+    while ( copied < src_length )
+    {
+        string_builder_chunk_t* chunk = builder->tail;
+        if ( !chunk || chunk->length == chunk->capacity )
+        {
+            chunk = _string_builder_chunk_create ( builder );
+        }
+        const u64 count = MIN ( src_length - copied
+                              , chunk->capacity - chunk->length
+                              );
+        memory_copy ( chunk->data + chunk->length , src + copied , count );
+        chunk->length += count;
+        copied += count;
+    }
+    builder->length += src_length;
+}
+
+string_t*
+string_builder_flatten
+(   const string_builder_t* builder
+)
+{//                                                        v terminator
+    string_t* string = _string_create ( builder->length + 1 );
+    u64 length = 0;
+    for ( const string_builder_chunk_t* chunk = builder->head
+        ; chunk
+        ; chunk = chunk->next
+        )
+    {
+        memory_copy ( string + length , chunk->data , chunk->length );
+        length += chunk->length;
+    }
+    _array_field_set ( string , ARRAY_FIELD_LENGTH , length + 1 );
+    return string;
+}
+
+bool
+string_builder_write
+(   const string_builder_t* builder
+,   file_t*                 file
+)
+{
+    for ( const string_builder_chunk_t* chunk = builder->head
+        ; chunk
+        ; chunk = chunk->next
+        )
+    {
+        u64 written;
+        if ( chunk->length && !file_write ( file , chunk->length , chunk->data , &written ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+string_builder_chunk_t*
+_string_builder_chunk_create
+(   string_builder_t* builder
+)
+{
+    string_builder_chunk_t* chunk = memory_allocate ( sizeof ( string_builder_chunk_t )
+                                                    + builder->chunk_capacity
+                                                    );
+    chunk->next = 0;
+    chunk->length = 0;
+    chunk->capacity = builder->chunk_capacity;
+    if ( builder->tail )
+    {
+        builder->tail->next = chunk;
+    }
+    else
+    {
+        builder->head = chunk;
+    }
+    builder->tail = chunk;
+    return chunk;
+}
\ No newline at end of file
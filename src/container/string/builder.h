@@ -0,0 +1,171 @@
+/**
+ * @file container/string/builder.h
+ * @brief Provides an interface for a chunked string builder, which constructs
+ * very long strings without ever reallocating them.
+ */
+#ifndef STRING_BUILDER_H
+#define STRING_BUILDER_H
+
+#include "common.h"
+
+#include "core/string.h"
+#include "platform/filesystem.h"
+
+/** @brief (see container/string.h) */
+typedef char string_t;
+
+/** @brief Defines string builder default chunk capacity (in characters). */
+#define STRING_BUILDER_DEFAULT_CHUNK_CAPACITY 65536
+
+/** @brief Type definition for a string builder chunk. */
+typedef struct string_builder_chunk_t
+{
+    struct string_builder_chunk_t*  next;
+    u64                             length;
+    u64                             capacity;
+    char                            data[];
+}
+string_builder_chunk_t;
+
+/**
+ * @brief Type definition for a string builder.
+ * 
+ * The content is stored in a list of fixed-capacity chunks. A chunk is never
+ * reallocated once allocated, so appending only ever copies the characters
+ * being appended, and memory usage never exceeds the content length by more
+ * than one chunk.
+ * 
+ * To read the content in place, iterate the chunks from head to tail:
+ * 
+ *   for ( const string_builder_chunk_t* chunk = builder.head
+ *       ; chunk
+ *       ; chunk = chunk->next
+ *       )
+ *   {
+ *       // chunk->data holds chunk->length characters (no terminator).
+ *   }
+ * 
+ * Alternatively, use string_builder_flatten to copy the content into a single
+ * resizable string, or string_builder_write to write it to a file.
+ * 
+ * Use string_builder_create to initialize.
+ */
+typedef struct
+{
+    string_builder_chunk_t* head;
+    string_builder_chunk_t* tail;
+    u64                     length;
+    u64                     chunk_capacity;
+}
+string_builder_t;
+
+/**
+ * @brief Initializes an empty string builder. O(1).
+ * 
+ * No memory is allocated until the first append. Call string_builder_destroy
+ * to free.
+ * 
+ * @param builder The builder to initialize. Must be non-zero.
+ * @param chunk_capacity The number of characters each chunk holds. Pass 0 to
+ * use STRING_BUILDER_DEFAULT_CHUNK_CAPACITY.
+ */
+void
+string_builder_create
+(   string_builder_t*   builder
+,   const u64           chunk_capacity
+);
+
+/**
+ * @brief Frees the memory used by a string builder.
+ * 
+ * @param builder The builder to free. Must be non-zero.
+ */
+void
+string_builder_destroy
+(   string_builder_t* builder
+);
+
+/**
+ * @brief Empties a string builder, keeping its first chunk for reuse.
+ * 
+ * @param builder The builder to clear. Must be non-zero.
+ */
+void
+string_builder_clear
+(   string_builder_t* builder
+);
+
+/**
+ * @brief Reads the current length of a string builder. O(1).
+ * 
+ * @param builder A string builder. Must be non-zero.
+ * @return The number of characters currently contained by builder.
+ */
+u64
+string_builder_length
+(   const string_builder_t* builder
+);
+
+/**
+ * @brief Appends to a string builder. O(n) in the length of src only.
+ * 
+ * Use string_builder_append to explicitly specify string length, or
+ * _string_builder_append to compute the length of a null-terminated string
+ * before passing it to __string_builder_append.
+ * 
+ * Uses dynamic memory allocation whenever a new chunk is required.
+ * 
+ * @param builder The builder to append to. Must be non-zero.
+ * @param src The string to append. Must be non-zero if src_length is
+ * non-zero.
+ * @param src_length The number of characters to copy from src.
+ */
+void
+__string_builder_append
+(   string_builder_t*   builder
+,   const char*         src
+,   const u64           src_length
+);
+
+#define string_builder_append(builder,src,length) \
+    __string_builder_append ( (builder) , (src) , (length) )
+
+#define _string_builder_append(builder,src)                    \
+    ({                                                         \
+        const char* src__ = (src);                             \
+        __string_builder_append ( (builder)                    \
+                                , src__                        \
+                                , _string_length ( src__ )     \
+                                );                             \
+    })
+
+/**
+ * @brief Copies the content of a string builder into a new resizable string.
+ * O(n).
+ * 
+ * Performs exactly one memory allocation. Call string_destroy to free.
+ * 
+ * @param builder The builder to copy. Must be non-zero.
+ * @return A resizable string holding the content of builder.
+ */
+string_t*
+string_builder_flatten
+(   const string_builder_t* builder
+);
+
+/**
+ * @brief Writes the content of a string builder to a file, one chunk at a
+ * time, without copying it. O(n).
+ * 
+ * @param builder The builder to write. Must be non-zero.
+ * @param file The file to write to. Must be non-zero.
+ * @return true if every chunk was written to file successfully; false
+ * otherwise.
+ */
+bool
+string_builder_write
+(   const string_builder_t* builder
+,   file_t*                 file
+);
+
+#endif  // STRING_BUILDER_H
\ No newline at end of file
@@ -97,6 +97,9 @@ format_modifiers[ STRING_FORMAT_MODIFIER_COUNT ] =
     ,   { .value = STRING_FORMAT_MODIFIER_TOKEN_RADIX
         , .length = sizeof ( STRING_FORMAT_MODIFIER_TOKEN_RADIX ) - 1
         }
+    ,   { .value = STRING_FORMAT_MODIFIER_TOKEN_SI_UNITS
+        , .length = sizeof ( STRING_FORMAT_MODIFIER_TOKEN_SI_UNITS ) - 1
+        }
     ,   { .value = STRING_FORMAT_MODIFIER_TOKEN_ARRAY
         , .length = sizeof ( STRING_FORMAT_MODIFIER_TOKEN_ARRAY ) - 1
         }
@@ -108,6 +111,75 @@ format_modifiers[ STRING_FORMAT_MODIFIER_COUNT ] =
         }
     };
 
+/**
+ * @brief Type definition for a table which maps the first character of a token
+ * directly to the tokens which begin with it.
+ * 
+ * first[ c ] holds one plus the index of the longest token beginning with c,
+ * or 0 if there is none; next[ i ] holds one plus the index of the next longest
+ * token sharing a first character with token i, or 0 if there is none. Holds up
+ * to 255 tokens.
+ */
+typedef struct
+{
+    u8  first[ 256 ];
+    u8  next[ 255 ];
+}
+string_format_dispatch_t;
+
+/**
+ * @brief Format specifier dispatch table (see format_specifiers).
+ * 
+ * Written out by hand rather than built on first use, so that decoding stays
+ * reentrant; a string-literal subscript is not a constant expression, so the
+ * first character of each token is repeated here. Must be updated alongside
+ * the format specifier tokens.
+ */
+static const
+string_format_dispatch_t
+format_specifier_dispatch =
+    {   .first = { [ '{' ] = 1 + STRING_FORMAT_SPECIFIER_NESTED
+                 , [ '%' ] = 1 + STRING_FORMAT_SPECIFIER_IGNORE
+                 , [ 'u' ] = 1 + STRING_FORMAT_SPECIFIER_RAW
+                 , [ 'i' ] = 1 + STRING_FORMAT_SPECIFIER_INTEGER
+                 , [ 'f' ] = 1 + STRING_FORMAT_SPECIFIER_FILE_INFO
+                 , [ 'F' ] = 1 + STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL
+                 , [ 'e' ] = 1 + STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED
+                 , [ 'd' ] = 1 + STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY
+                 , [ '@' ] = 1 + STRING_FORMAT_SPECIFIER_ADDRESS
+                 , [ 'c' ] = 1 + STRING_FORMAT_SPECIFIER_CHARACTER
+                 , [ 's' ] = 1 + STRING_FORMAT_SPECIFIER_BYTESIZE
+                 , [ 'S' ] = 1 + STRING_FORMAT_SPECIFIER_RESIZABLE_STRING
+                 , [ 'B' ] = 1 + STRING_FORMAT_SPECIFIER_BOOLEAN
+                 , [ 'b' ] = 1 + STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED
+                 }
+        // Longest first: %file before %f, %size before %s.
+    ,   .next = { [ STRING_FORMAT_SPECIFIER_FILE_INFO ] = 1 + STRING_FORMAT_SPECIFIER_FLOATING_POINT
+                , [ STRING_FORMAT_SPECIFIER_BYTESIZE ]  = 1 + STRING_FORMAT_SPECIFIER_STRING
+                }
+    };
+
+/**
+ * @brief Format modifier dispatch table (see format_modifiers and
+ * format_specifier_dispatch). Must be updated alongside the format modifier
+ * tokens.
+ */
+static const
+string_format_dispatch_t
+format_modifier_dispatch =
+    {   .first = { [ 'P' ] = 1 + STRING_FORMAT_MODIFIER_PAD
+                 , [ 'p' ] = 1 + STRING_FORMAT_MODIFIER_PAD_MINIMUM
+                 , [ '+' ] = 1 + STRING_FORMAT_MODIFIER_SHOW_SIGN
+                 , [ '-' ] = 1 + STRING_FORMAT_MODIFIER_HIDE_SIGN
+                 , [ '.' ] = 1 + STRING_FORMAT_MODIFIER_FIX_PRECISION
+                 , [ 'r' ] = 1 + STRING_FORMAT_MODIFIER_RADIX
+                 , [ 'k' ] = 1 + STRING_FORMAT_MODIFIER_SI_UNITS
+                 , [ 'a' ] = 1 + STRING_FORMAT_MODIFIER_ARRAY
+                 , [ 'A' ] = 1 + STRING_FORMAT_MODIFIER_RESIZABLE_ARRAY
+                 , [ '[' ] = 1 + STRING_FORMAT_MODIFIER_SLICE
+                 }
+    };
+
 /** @brief Type and instance definitions for a string padding.alignment. */
 typedef enum
 {
@@ -116,6 +188,18 @@ typedef enum
 }
 STRING_FORMAT_ALIGNMENT;
 
+/**
+ * @brief Maximum length of a padding string which is unescaped ahead of time
+ * (see string_format_padding_t).
+ */
+#define STRING_FORMAT_PAD_PATTERN_MAX_LENGTH 32
+
+/**
+ * @brief Number of padding characters generated at a time before being
+ * written to the output sink (see _string_format_write_padding).
+ */
+#define STRING_FORMAT_PAD_BLOCK_SIZE 256
+
 /** @brief Type definition for a container to hold string padding configuration info. */
 typedef struct
 {
@@ -126,12 +210,12 @@ typedef struct
 
     string_format_token_t   value;
     bool                    value_set_from_wildcard;
+
+    char                    pattern[ STRING_FORMAT_PAD_PATTERN_MAX_LENGTH ];
+    u64                     pattern_length;
 }
 string_format_padding_t;
 
-/** @brief Maximum pad width. */
-#define STRING_FORMAT_MAX_PAD_WIDTH 65535
-
 /** @brief Type and instance definitions for a sign tag. */
 typedef enum
 {
@@ -216,6 +300,18 @@ typedef struct
 }
 string_format_array_t;
 
+/**
+ * @brief Number of characters of array elements which may be staged before
+ * being written to the output sink (see _string_format_parse_argument_array).
+ */
+#define STRING_FORMAT_ARRAY_CHUNK_SIZE 4096
+
+/**
+ * @brief Maximum length of an array separator token which may be stripped of
+ * escape sequences ahead of time (see _string_format_parse_argument_array).
+ */
+#define STRING_FORMAT_ARRAY_SEPARATOR_MAX_LENGTH 256
+
 /** @brief Type definition for a container to hold collection info. */
 typedef struct
 {
@@ -252,6 +348,8 @@ typedef struct
 
     string_format_modifier_t    modifier;
     bool                        modifiers[ STRING_FORMAT_MODIFIER_COUNT ];
+
+    bool                        wildcard;
 }
 string_format_specifier_t;
 
@@ -268,10 +366,78 @@ typedef struct
     const char* copy_start;
     const char* copy_end;
 
-    string_t*   string;
+    string_format_sink_t*   sink;
+
+    bool        nested;
+    bool        compile;
 }
 state_t;
 
+/** @brief Type and instance definitions for a compiled format string operation tag. */
+typedef enum
+{
+    STRING_FORMAT_OPERATION_COPY
+,   STRING_FORMAT_OPERATION_PRINT
+,   STRING_FORMAT_OPERATION_VALIDATE
+,   STRING_FORMAT_OPERATION_INTERPRET
+}
+STRING_FORMAT_OPERATION;
+
+/** @brief Type definition for a container to hold a compiled format string operation. */
+typedef struct
+{
+    STRING_FORMAT_OPERATION     tag;
+    const char*                 read;
+    u64                         length;
+    string_format_specifier_t   format_specifier;
+}
+string_format_operation_t;
+
+/** @brief Type definition for a compiled format string. */
+struct string_format_program_t
+{
+    string_t*                   format;
+    string_format_operation_t*  operations;
+};
+
+/**
+ * @brief Number of rows rendered before the output string is sized for the
+ * remaining rows (see string_format_rows).
+ */
+#define STRING_FORMAT_ROWS_SAMPLE_COUNT 16
+
+/** @brief Format string cache set size (see string_format_cache_startup). */
+#define STRING_FORMAT_CACHE_WAYS 8
+
+/** @brief Type definition for a format string cache entry. */
+typedef struct
+{
+    const char*                 format;
+    u64                         format_length;
+    string_format_program_t*    program;
+
+    u64                         timestamp;
+    u64                         references;
+}
+string_format_cache_entry_t;
+
+/** @brief Type definition for the format string cache. */
+typedef struct
+{
+    bool                            owns_memory;
+    bool                            lock;
+
+    string_format_cache_entry_t*    entries;
+    u64                             set_count;
+    u64                             timestamp;
+
+    string_format_cache_stats_t     stats;
+}
+string_format_cache_t;
+
+/** @brief Format string cache (see string_format_cache_startup). */
+static string_format_cache_t* cache;
+
 /** @brief Defines next copy size. */
 #define STRING_FORMAT_COPY_SIZE(state) \
     MAX ( 0 , (state)->copy_end - (state)->copy_start )
@@ -307,18 +473,204 @@ _memory_equal
     return memory_equal ( s1 , s2 , size );
 }
 
+/**
+ * @brief Matches the token at the read head against a dispatch table. O(token
+ * length).
+ * 
+ * If more than one token matches, the longest wins (i.e. %size rather than %s).
+ * 
+ * @param dispatch The dispatch table to match against.
+ * @param tokens The token lookup table indexed by the dispatch table.
+ * @param token_count The number of tokens in the lookup table.
+ * @param read Current read head. Must be less than limit.
+ * @param limit The read limit for the format string.
+ * @return The index of the matching token, or token_count if there is none.
+ */
+INLINE
+u64
+_string_format_dispatch
+(   const string_format_dispatch_t* dispatch
+,   const string_format_token_t*    tokens
+,   const u64                       token_count
+,   const char*                     read
+,   const char*                     limit
+)
+{
+    for ( u8 i = dispatch->first[ ( u8 )( read[ 0 ] ) ]
+        ; i
+        ; i = dispatch->next[ i - 1 ]
+        )
+    {
+        if ( _memory_equal ( read + 1
+                           , tokens[ i - 1 ].value + 1
+                           , tokens[ i - 1 ].length - 1
+                           , limit
+                           ))
+        {
+            return i - 1;
+        }
+    }
+    return token_count;
+}
+
+/** @brief Type definition for a vector of sixteen characters (see _string_format_scan). */
+typedef u8 string_format_scan_vector_t __attribute__ (( vector_size ( 16 ) ));
+
+/**
+ * @brief Scans a format string for the next character which may begin a
+ * format specifier (i.e. the first character of
+ * STRING_FORMAT_SPECIFIER_TOKEN_ID).
+ * 
+ * Compares sixteen characters at a time using a compiler vector (SSE2 or NEON
+ * on targets which support it), then finishes the tail one character at a time.
+ * 
+ * @param read Current read head.
+ * @param limit The read limit for the format string.
+ * @return The position of the next candidate, or limit if there is none.
+ */
+INLINE
+const char*
+_string_format_scan
+(   const char* read
+,   const char* limit
+)
+{
+    const char token = STRING_FORMAT_SPECIFIER_TOKEN_ID[ 0 ];
+    const string_format_scan_vector_t pattern = ( string_format_scan_vector_t ){ 0 } + ( u8 ) token;
+    
+    while ( read + sizeof ( string_format_scan_vector_t ) <= limit )
+    {
+        string_format_scan_vector_t block;
+        __builtin_memcpy ( &block , read , sizeof ( block ) );
+        block = ( string_format_scan_vector_t )( block == pattern );
+
+        // Each matching character is now 0xFF; find the first.
+        u64 mask[ 2 ];
+        __builtin_memcpy ( mask , &block , sizeof ( mask ) );
+        if ( mask[ 0 ] | mask[ 1 ] )
+        {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return ( mask[ 0 ] ) ? read + ( __builtin_clzll ( mask[ 0 ] ) >> 3 )
+                                 : read + 8 + ( __builtin_clzll ( mask[ 1 ] ) >> 3 );
+#else
+            return ( mask[ 0 ] ) ? read + ( __builtin_ctzll ( mask[ 0 ] ) >> 3 )
+                                 : read + 8 + ( __builtin_ctzll ( mask[ 1 ] ) >> 3 );
+#endif
+        }
+        read += sizeof ( string_format_scan_vector_t );
+    }
+
+    while ( read < limit && *read != token )
+    {
+        read += 1;
+    }
+    return read;
+}
+
 /**
  * @brief Variant of _string_format which starts processing a format string
  * given an initial working state (see _string_format).
  * 
  * @param state Internal state parameters.
- * @return The formatted string.
  */
-string_t*
+void
 __string_format
 (   state_t* state
 );
 
+/**
+ * @brief Variant of _string_format_execute which starts executing a compiled
+ * format string given an initial working state (see _string_format_execute).
+ * 
+ * @param state Internal state parameters.
+ * @param program A compiled format string.
+ */
+void
+__string_format_execute
+(   state_t*                        state
+,   const string_format_program_t*  program
+);
+
+/**
+ * @brief Processes a format string given an initial working state. Executes
+ * the compiled form of the format string if the format string cache is
+ * running; otherwise, interprets the format string (see __string_format).
+ * 
+ * @param state Internal state parameters.
+ */
+void
+_string_format_run
+(   state_t* state
+);
+
+/**
+ * @brief Fetches the compiled form of a format string from the format string
+ * cache, compiling it on a miss. Thread-safe.
+ * 
+ * The entry is referenced on return, so that no other thread may evict it
+ * while it is executing; call _string_format_cache_release once finished.
+ * 
+ * @param format Formatting string.
+ * @param format_length The number of characters in format.
+ * @return The cache entry holding the compiled format string, or 0 if every
+ * entry which may hold it is currently executing.
+ */
+string_format_cache_entry_t*
+_string_format_cache_fetch
+(   const char* format
+,   const u64   format_length
+);
+
+/**
+ * @brief Releases a format string cache entry acquired by
+ * _string_format_cache_fetch. Thread-safe.
+ * 
+ * @param entry The cache entry to release.
+ */
+INLINE
+void
+_string_format_cache_release
+(   string_format_cache_entry_t* entry
+);
+
+/**
+ * @brief Acquires exclusive access to the format string cache. Spins until
+ * every other thread has called _string_format_cache_unlock.
+ */
+INLINE
+void
+_string_format_cache_lock
+( void );
+
+/**
+ * @brief Relinquishes exclusive access to the format string cache (see
+ * _string_format_cache_lock).
+ */
+INLINE
+void
+_string_format_cache_unlock
+( void );
+
+/**
+ * @brief Appends an operation to a compiled format string.
+ * 
+ * @param program A compiled format string.
+ * @param tag The operation tag.
+ * @param read The position of the operation within the format string.
+ * @param length The number of characters of the format string spanned by the
+ * operation.
+ * @param format_specifier The pre-decoded format specifier (only applies to
+ * STRING_FORMAT_OPERATION_PRINT and STRING_FORMAT_OPERATION_VALIDATE).
+ */
+void
+_string_format_compile_operation
+(   string_format_program_t*            program
+,   const STRING_FORMAT_OPERATION       tag
+,   const char*                         read
+,   const u64                           length
+,   const string_format_specifier_t*    format_specifier
+);
+
 /**
  * @brief Advances to the n-th next argument in the variadic argument list.
  * 
@@ -369,10 +721,59 @@ void _string_format_validate_format_modifier_pad ( state_t* state , const char**
 void _string_format_validate_format_modifier_sign ( state_t* state , const char** read , STRING_FORMAT_SIGN sign, string_format_specifier_t* format_specifier );
 void _string_format_validate_format_modifier_fix_precision ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
 void _string_format_validate_format_modifier_radix ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
+void _string_format_validate_format_modifier_si_units ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
 void _string_format_validate_format_modifier_array ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
 void _string_format_validate_format_modifier_resizable_array ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
 void _string_format_validate_format_modifier_slice ( state_t* state , const char** read , string_format_specifier_t* format_specifier );
 
+/**
+ * @brief Fills out the collection info for a format specifier by peeking the
+ * corresponding argument(s) in the variadic argument list. If the collection is
+ * sliced, the slice range is validated against the collection length.
+ * 
+ * @param state Internal state arguments.
+ * @param format_specifier A format specifier with a collection tag.
+ * @return false if the slice range is out of bounds; true otherwise.
+ */
+bool
+_string_format_peek_collection
+(   state_t*                    state
+,   string_format_specifier_t*  format_specifier
+);
+
+/**
+ * @brief Retrieves the address of the floating point number held by the next
+ * argument in the variadic argument list.
+ * 
+ * Floating point numbers are passed by address (see common/args.h), unless the
+ * argument list is typed and the number was passed by value, in which case it
+ * is stored directly in the argument list (see TYPED_ARGS).
+ * 
+ * @param state Internal state arguments.
+ * @return The address of the floating point number (possibly 0).
+ */
+INLINE
+const f64*
+_string_format_next_argument_f64
+(   const state_t* state
+);
+
+#if VERSION_DEBUG == 1
+/**
+ * @brief Debug-mode-only check that the type of each argument consumed by a
+ * format specifier matches the type it expects. Only a typed variadic argument
+ * list can be checked (see TYPED_ARGS); logs an error for each mismatch.
+ * 
+ * @param state Internal state arguments.
+ * @param format_specifier A format specifier.
+ */
+void
+_string_format_validate_argument_types
+(   const state_t*                      state
+,   const string_format_specifier_t*    format_specifier
+);
+#endif
+
 /**
  * @brief Parses and prints the next argument according to the current format
  * specifier and modifier(s).
@@ -406,53 +807,279 @@ u64 _string_format_parse_argument_array ( state_t* state , const string_format_s
 u64 _string_format_parse_argument_nested ( state_t* state , const string_format_specifier_t* format_specifier );
 
 /**
- * @brief Wrapper for string_append that respects the left- and right- padding
- * format modifiers, if they are set.
+ * @brief Parses and prints a single array element according to a format
+ * specifier and the array stride (see _string_format_parse_argument_array).
+ * 
+ * @param state Internal state arguments.
+ * @param format_specifier An array format specifier.
+ * @param element The address of the element.
+ */
+void
+_string_format_parse_argument_array_element
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+,   const void*                         element
+);
+
+/**
+ * @brief Kernel for _string_format_parse_argument_array which prints an array
+ * of integers (%u or %i) with no padding or sign format modifiers, converting
+ * each element directly into the staging buffer.
+ * 
+ * The separator, the longest possible element and a terminator must fit in
+ * the staging buffer together; longer separators are handled by the generic
+ * element path instead.
+ * 
+ * @param format_specifier An array format specifier.
+ * @param separator The array separator token (stripped of escape sequences).
+ * @param sink The output sink.
+ * @param chunk The staging buffer (see STRING_FORMAT_ARRAY_CHUNK_SIZE).
+ */
+void
+_string_format_parse_argument_array_integers
+(   const string_format_specifier_t*    format_specifier
+,   const string_format_token_t*        separator
+,   string_format_sink_t*               sink
+,   string_format_sink_t*               chunk
+);
+
+/**
+ * @brief Renders a nested format substring directly to the output sink,
+ * without padding (see _string_format_parse_argument_nested).
+ * 
+ * @param state Internal state arguments.
+ * @param format_specifier A nested format specifier.
+ */
+void
+_string_format_render_nested
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+);
+
+/**
+ * @brief Discards everything written to a sink past the specified length.
+ * Only applies to a STRING_FORMAT_SINK_STRING or STRING_FORMAT_SINK_BUFFER
+ * sink.
+ * 
+ * @param sink The sink to truncate.
+ * @param length The new length (see string_format_sink_t).
+ */
+void
+_string_format_sink_truncate
+(   string_format_sink_t*   sink
+,   const u64               length
+);
+
+/**
+ * @brief Wrapper for _string_format_write that respects the left- and right-
+ * padding format modifiers, if they are set.
  * 
- * @param string The **handle to** a resizable string to append to.
+ * @param state Internal state arguments.
  * @param src The string to append.
  * @param src_length The number of characters contained by src.
  * @param format_specifier A format specifier.
  * @return The number of characters written to the string being constructed.
  */
 u64
-_string_format_append
-(   string_t**                          string
+_string_format_write_padded
+(   state_t*                            state
 ,   const char*                         src
 ,   const u64                           src_length
 ,   const string_format_specifier_t*    format_specifier
 );
 
-string_t*
-_string_format
-(   const char* format
-,   args_t      args
+/**
+ * @brief Writes the padding string specified by a format specifier, repeating
+ * it as needed to fill the requested width.
+ * 
+ * @param state Internal state arguments.
+ * @param format_specifier A format specifier with the padding format modifier
+ * set.
+ * @param pad_width The number of characters to write.
+ */
+void
+_string_format_write_padding
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+,   const u64                           pad_width
+);
+
+/**
+ * @brief Writes to the output sink (see string_format_sink_write).
+ * 
+ * @param state Internal state arguments.
+ * @param src The string to append.
+ * @param src_length The number of characters contained by src.
+ */
+INLINE
+void
+_string_format_write
+(   state_t*    state
+,   const char* src
+,   const u64   src_length
 )
 {
-    if ( !format || ( args.arg_count && !args.args ) )
+    string_format_sink_write ( state->sink , src , src_length );
+}
+
+INLINE
+const f64*
+_string_format_next_argument_f64
+(   const state_t* state
+)
+{
+    if (   state->args.types
+        && state->args.types[ state->next_arg - state->args.args ] == ARG_TYPE_F64
+       )
     {
-        if ( !format )                      LOGERROR ( "_string_format: Missing argument: format (formatting string)." );
-        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format: Invalid argument: args (variadic argument list).\n\t"
-                                                       "List is null, but count indicates it should contain %u element%s."
-                                                     , args.arg_count
-                                                     , ( args.arg_count > 1 ) ? "s" : ""
-                                                     );
-        return string_create_from ( "" );
+        return ( const f64* )( state->next_arg );
     }
-    
-    state_t state;
-    state.format = format;
-    state.format_length = _string_length ( state.format );
-    state.args = args;
-    state.next_arg = state.args.args;
-    state.args_remaining = state.args.arg_count;
-    state.string = _string_create ( state.format_length + 1 );
-    return __string_format ( &state );
+    return *( ( const f64** )( state->next_arg ) );
 }
 
-string_t*
-__string_format
-(   state_t* state
+#if VERSION_DEBUG == 1
+void
+_string_format_validate_argument_types
+(   const state_t*                      state
+,   const string_format_specifier_t*    format_specifier
+)
+{
+    if ( !state->args.types )
+    {
+        return;
+    }
+
+    // A floating point format specifier accepts a floating point number either
+    // by value or by address; every other argument must be an integer,
+    // character, boolean, or address.
+    const bool floating_point =    format_specifier->modifier.collection.tag == STRING_FORMAT_COLLECTION_NONE
+                                && (   format_specifier->tag == STRING_FORMAT_SPECIFIER_FLOATING_POINT
+                                    || format_specifier->tag == STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL
+                                    || format_specifier->tag == STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED
+                                    || format_specifier->tag == STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY
+                                   )
+                                ;
+    if ( floating_point )
+    {
+        return;
+    }
+
+    const u64 index = state->next_arg - state->args.args;
+    const u64 count = MIN ( format_specifier->arg_count , state->args_remaining );
+    for ( u64 i = 0; i < count; ++i )
+    {
+        if ( state->args.types[ index + i ] == ARG_TYPE_F64 )
+        {
+            LOGERROR ( "_string_format: Argument %u is a floating point number, but format specifier %%%s expects an integer, character, boolean, or address."
+                     , index + i
+                     , format_specifiers[ format_specifier->tag ].value
+                     );
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Variant of _string_format_write which strips a token of escaped
+ * `|`, `[` and `]` characters while writing it.
+ * 
+ * @param state Internal state arguments.
+ * @param token The token to write.
+ * @param strip_escape Strip escape sequences? Y/N
+ */
+void
+_string_format_write_token
+(   state_t*                        state
+,   const string_format_token_t*    token
+,   const bool                      strip_escape
+);
+
+/**
+ * @brief Variant of _string_format_write for copying a span of the format
+ * string. Strips escaped `{` and `}` characters while writing if the format
+ * string is a nested format substring.
+ * 
+ * @param state Internal state arguments.
+ * @param src The span to write.
+ * @param src_length The number of characters contained by src.
+ */
+void
+_string_format_write_literal
+(   state_t*    state
+,   const char* src
+,   const u64   src_length
+);
+
+/**
+ * @brief Processes a format string to completion with an output string of
+ * exactly the required length (see _string_format_exact).
+ * 
+ * @param state Internal state arguments.
+ * @return The formatted string.
+ */
+string_t*
+_string_format_exact_
+(   state_t* state
+);
+
+string_t*
+_string_format
+(   const char* format
+,   args_t      args
+)
+{
+    if ( !format || ( args.arg_count && !args.args ) )
+    {
+        if ( !format )                      LOGERROR ( "_string_format: Missing argument: format (formatting string)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        return string_create_from ( "" );
+    }
+    
+    string_format_sink_t sink;
+    state_t state;
+    state.format = format;
+    state.format_length = _string_length ( state.format );
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = &sink;
+    state.nested = false;
+    state.compile = false;
+
+    string_format_sink_string ( &sink , _string_create ( state.format_length + 1 ) );
+    _string_format_run ( &state );
+    return sink.string;
+}
+
+void
+_string_format_run
+(   state_t* state
+)
+{
+    // Format string cache running? Y/N
+    if ( cache )
+    {
+        string_format_cache_entry_t* entry = _string_format_cache_fetch ( state->format
+                                                                        , state->format_length
+                                                                        );
+        if ( entry )
+        {
+            __string_format_execute ( state , entry->program );
+            _string_format_cache_release ( entry );
+            return;
+        }
+    }
+
+    __string_format ( state );
+}
+
+void
+__string_format
+(   state_t* state
 )
 {
     // Parse the format string.
@@ -467,12 +1094,16 @@ __string_format
         }
 
         // Read until next format specifier reached.
-        if (   read[ 0 ] != STRING_FORMAT_SPECIFIER_TOKEN_ID[ 0 ]
-            || !_memory_equal ( read + 1
-                              , STRING_FORMAT_SPECIFIER_TOKEN_ID + 1
-                              , sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 2
-                              , STRING_FORMAT_READ_LIMIT ( state )
-                              ))
+        read = _string_format_scan ( read , STRING_FORMAT_READ_LIMIT ( state ) );
+        if ( read >= STRING_FORMAT_READ_LIMIT ( state ) )
+        {
+            break;
+        }
+        if ( !_memory_equal ( read + 1
+                            , STRING_FORMAT_SPECIFIER_TOKEN_ID + 1
+                            , sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 2
+                            , STRING_FORMAT_READ_LIMIT ( state )
+                            ))
         {
             read += 1;
             continue;
@@ -497,42 +1128,951 @@ __string_format
 
         // Copy from the write position to the current read position.
         state->copy_end = read;
-        string_append ( state->string
-                      , state->copy_start
-                      , STRING_FORMAT_COPY_SIZE ( state )
-                      );
+        _string_format_write_literal ( state
+                                     , state->copy_start
+                                     , STRING_FORMAT_COPY_SIZE ( state )
+                                     );
+
+        // Ignore? Y/N
+        if ( format_specifier.tag == STRING_FORMAT_SPECIFIER_IGNORE )
+        {
+            // Update the read and write position.
+            read += 2 * ( sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1 );
+            state->copy_start = read;
+
+            // Append the token.
+            _string_format_write ( state
+                                 , STRING_FORMAT_SPECIFIER_TOKEN_IGNORE
+                                 , sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1
+                                 );
+
+            continue;
+        }
+
+        // Parse and print the next argument according to the format specifier.
+        _string_format_parse_next_argument ( state , &format_specifier );
+
+        // Update the read and write position.
+        read += format_specifier.length;
+        state->copy_start = read;
+    }
+
+    // Copy from the write position to the end of the format string.
+    state->copy_end = STRING_FORMAT_READ_LIMIT ( state );
+    _string_format_write_literal ( state
+                                 , state->copy_start
+                                 , STRING_FORMAT_COPY_SIZE ( state )
+                                 );
+}
+
+string_t*
+_string_format_exact
+(   const char* format
+,   args_t      args
+)
+{
+    if ( !format || ( args.arg_count && !args.args ) )
+    {
+        if ( !format )                      LOGERROR ( "_string_format_exact: Missing argument: format (formatting string)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format_exact: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        return string_create_from ( "" );
+    }
+
+    state_t state;
+    state.format = format;
+    state.format_length = _string_length ( state.format );
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = 0;
+    state.nested = false;
+    state.compile = false;
+
+    return _string_format_exact_ ( &state );
+}
+
+string_t*
+_string_format_exact_
+(   state_t* state
+)
+{
+    const char* const format = state->format;
+    const u64 format_length = state->format_length;
+    arg_t* const next_arg = state->next_arg;
+    const u64 args_remaining = state->args_remaining;
+
+    // Look up the compiled format string once, so that both passes execute
+    // it and the cache records a single access.
+    string_format_cache_entry_t* entry = ( cache ) ? _string_format_cache_fetch ( format , format_length )
+                                                   : 0
+                                                   ;
+
+    // Pass 1: Measure the exact output length without writing anything.
+    string_format_sink_t sink;
+    string_format_sink_buffer ( &sink , 0 , 0 );
+    state->sink = &sink;
+    if ( entry )
+    {
+        __string_format_execute ( state , entry->program );
+    }
+    else
+    {
+        __string_format ( state );
+    }
+    const u64 length = sink.length;
+
+    // Pass 2: Allocate once, then write with the same argument list.
+    string_t* string = _string_create ( length + 1 );
+    string_format_sink_buffer ( &sink , string , length );
+    state->format = format;
+    state->format_length = format_length;
+    state->next_arg = next_arg;
+    state->args_remaining = args_remaining;
+    if ( entry )
+    {
+        __string_format_execute ( state , entry->program );
+        _string_format_cache_release ( entry );
+    }
+    else
+    {
+        __string_format ( state );
+    }
+
+    _array_field_set ( string , ARRAY_FIELD_LENGTH , length + 1 );
+    string[ length ] = 0; // Append terminator.
+    return string;
+}
+
+u64
+_string_format_into
+(   char*       dst
+,   const u64   capacity
+,   const char* format
+,   args_t      args
+)
+{
+    if ( !format || ( capacity && !dst ) || ( args.arg_count && !args.args ) )
+    {
+        if ( !format )                      LOGERROR ( "_string_format_into: Missing argument: format (formatting string)." );
+        if ( capacity && !dst )             LOGERROR ( "_string_format_into: Missing argument: dst (output buffer)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format_into: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        if ( capacity && dst )
+        {
+            dst[ 0 ] = 0; // Append terminator.
+        }
+        return 0;
+    }
+
+    string_format_sink_t sink;
+    state_t state;
+    state.format = format;
+    state.format_length = _string_length ( state.format );
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = &sink;
+    state.nested = false;
+    state.compile = false;
+
+    string_format_sink_buffer ( &sink
+                              , dst
+                              , capacity ? capacity - 1 : 0 // Reserve terminator.
+                              );
+    _string_format_run ( &state );
+
+    if ( capacity )
+    {
+        dst[ MIN ( sink.length , sink.buffer.capacity ) ] = 0; // Append terminator.
+    }
+    return sink.length;
+}
+
+u64
+_string_format_to
+(   string_format_sink_t*   sink
+,   const char*             format
+,   args_t                  args
+)
+{
+    if ( !sink || !format || ( args.arg_count && !args.args ) )
+    {
+        if ( !sink )                        LOGERROR ( "_string_format_to: Missing argument: sink (output sink)." );
+        if ( !format )                      LOGERROR ( "_string_format_to: Missing argument: format (formatting string)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format_to: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        return 0;
+    }
+
+    state_t state;
+    state.format = format;
+    state.format_length = _string_length ( state.format );
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = sink;
+    state.nested = false;
+    state.compile = false;
+
+    const u64 old_length = sink->length;
+    _string_format_run ( &state );
+    return sink->length - old_length;
+}
+
+u64
+_string_format_append
+(   string_t**  string
+,   const char* format
+,   args_t      args
+)
+{
+    if ( !string || !*string || !format || ( args.arg_count && !args.args ) )
+    {
+        if ( !string || !*string )          LOGERROR ( "_string_format_append: Missing argument: string (resizable string to append to)." );
+        if ( !format )                      LOGERROR ( "_string_format_append: Missing argument: format (formatting string)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format_append: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        return 0;
+    }
+
+    string_format_sink_t sink;
+    state_t state;
+    state.format = format;
+    state.format_length = _string_length ( state.format );
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = &sink;
+    state.nested = false;
+    state.compile = false;
+
+    string_format_sink_string ( &sink , *string );
+    _string_format_run ( &state );
+    *string = sink.string;
+    return sink.length;
+}
+
+void
+string_format_sink_string
+(   string_format_sink_t*   sink
+,   string_t*               string
+)
+{
+    sink->tag = STRING_FORMAT_SINK_STRING;
+    sink->length = 0;
+    sink->string = string;
+}
+
+void
+string_format_sink_buffer
+(   string_format_sink_t*   sink
+,   char*                   dst
+,   const u64               capacity
+)
+{
+    sink->tag = STRING_FORMAT_SINK_BUFFER;
+    sink->length = 0;
+    sink->buffer.data = dst;
+    sink->buffer.capacity = capacity;
+}
+
+void
+string_format_sink_file
+(   string_format_sink_t*   sink
+,   file_t*                 file
+)
+{
+    sink->tag = STRING_FORMAT_SINK_FILE;
+    sink->length = 0;
+    sink->file.file = file;
+    sink->file.valid = true;
+    sink->file.buffered = 0;
+}
+
+void
+string_format_sink_builder
+(   string_format_sink_t*   sink
+,   string_builder_t*       builder
+)
+{
+    sink->tag = STRING_FORMAT_SINK_BUILDER;
+    sink->length = 0;
+    sink->builder = builder;
+}
+
+void
+string_format_sink_write
+(   string_format_sink_t*   sink
+,   const char*             src
+,   const u64               src_length
+)
+{
+    switch ( sink->tag )
+    {
+        case STRING_FORMAT_SINK_STRING:
+        {
+            string_append ( sink->string , src , src_length );
+        }
+        break;
+
+        case STRING_FORMAT_SINK_BUFFER:
+        {
+            // Capacity reached? Y/N
+            if ( sink->length < sink->buffer.capacity )
+            {
+                memory_copy ( sink->buffer.data + sink->length
+                            , src
+                            , MIN ( src_length , sink->buffer.capacity - sink->length )
+                            );
+            }
+        }
+        break;
+
+        case STRING_FORMAT_SINK_FILE:
+        {
+            // Buffer full? Y/N
+            if ( sink->file.buffered + src_length > STRING_FORMAT_SINK_FILE_BUFFER_SIZE )
+            {
+                string_format_sink_flush ( sink );
+            }
+
+            // CASE: Source string does not fit in the buffer; write it directly.
+            if ( src_length > STRING_FORMAT_SINK_FILE_BUFFER_SIZE )
+            {
+                u64 written;
+                if (   sink->file.valid
+                    && !file_write ( sink->file.file , src_length , src , &written )
+                   )
+                {
+                    sink->file.valid = false;
+                }
+            }
+
+            // CASE: Source string fits in the buffer.
+            else
+            {
+                memory_copy ( sink->file.data + sink->file.buffered
+                            , src
+                            , src_length
+                            );
+                sink->file.buffered += src_length;
+            }
+        }
+        break;
+
+        case STRING_FORMAT_SINK_BUILDER:
+        {
+            string_builder_append ( sink->builder , src , src_length );
+        }
+        break;
+
+        default:
+        {}
+        break;
+    }
+    sink->length += src_length;
+}
+
+bool
+string_format_sink_flush
+(   string_format_sink_t* sink
+)
+{
+    if ( sink->tag != STRING_FORMAT_SINK_FILE )
+    {
+        return true;
+    }
+
+    u64 written;
+    if (   sink->file.valid
+        && sink->file.buffered
+        && !file_write ( sink->file.file , sink->file.buffered , sink->file.data , &written )
+       )
+    {
+        sink->file.valid = false;
+    }
+    sink->file.buffered = 0;
+    return sink->file.valid;
+}
+
+string_format_program_t*
+_string_format_compile
+(   const char* format
+,   const u64   format_length
+)
+{
+    if ( !format )
+    {
+        LOGERROR ( "_string_format_compile: Missing argument: format (formatting string)." );
+        return 0;
+    }
+
+    string_format_program_t* program = memory_allocate ( sizeof ( string_format_program_t ) );
+    program->format = string_copy ( format , format_length );
+    program->operations = array_create_new ( string_format_operation_t );
+
+    // Argument values are unknown while compiling; each format specifier is
+    // validated as if the variadic argument list were unbounded, and any
+    // dependency on argument values is deferred until execution time.
+    state_t state;
+    state.format = program->format;
+    state.format_length = format_length;
+    state.args.arg_count = 0;
+    state.args.args = 0;
+    state.args.types = 0;
+    state.next_arg = 0;
+    state.args_remaining = ( ( u64 )( -1 ) );
+    state.sink = 0;
+    state.nested = false;
+    state.compile = true;
+
+    // Parse the format string.
+    const char* read = state.format;
+    state.copy_start = read;
+    for (;;)
+    {
+        // Out of bounds? Y/N
+        if ( read >= STRING_FORMAT_READ_LIMIT ( &state ) )
+        {
+            break;
+        }
+
+        // Read until next format specifier reached.
+        read = _string_format_scan ( read , STRING_FORMAT_READ_LIMIT ( &state ) );
+        if ( read >= STRING_FORMAT_READ_LIMIT ( &state ) )
+        {
+            break;
+        }
+        if ( !_memory_equal ( read + 1
+                            , STRING_FORMAT_SPECIFIER_TOKEN_ID + 1
+                            , sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 2
+                            , STRING_FORMAT_READ_LIMIT ( &state )
+                            ))
+        {
+            read += 1;
+            continue;
+        }
+
+        // Validate format specifier.
+        string_format_specifier_t format_specifier;
+        _string_format_validate_format_specifier ( &state
+                                                 , read + sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1
+                                                 , &format_specifier
+                                                 );
+
+        // Ignore? Y/N
+        if ( format_specifier.tag == STRING_FORMAT_SPECIFIER_IGNORE )
+        {
+            // Copy up to and including the first token.
+            state.copy_end = read + sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1;
+            _string_format_compile_operation ( program
+                                             , STRING_FORMAT_OPERATION_COPY
+                                             , state.copy_start
+                                             , STRING_FORMAT_COPY_SIZE ( &state )
+                                             , 0
+                                             );
+
+            // Update the read and write position.
+            read += 2 * ( sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1 );
+            state.copy_start = read;
+            continue;
+        }
+
+        // Copy from the write position to the current read position.
+        state.copy_end = read;
+        _string_format_compile_operation ( program
+                                         , STRING_FORMAT_OPERATION_COPY
+                                         , state.copy_start
+                                         , STRING_FORMAT_COPY_SIZE ( &state )
+                                         , 0
+                                         );
+
+        // Valid? Y/N
+        // If not, how the token is consumed depends on the argument list, so
+        // the remainder of the format string must be interpreted at execution
+        // time.
+        if ( format_specifier.tag == STRING_FORMAT_SPECIFIER_INVALID )
+        {
+            _string_format_compile_operation ( program
+                                             , STRING_FORMAT_OPERATION_INTERPRET
+                                             , read
+                                             , STRING_FORMAT_READ_LIMIT ( &state ) - read
+                                             , 0
+                                             );
+            return program;
+        }
+
+        // Format specifiers with wildcards must be validated against the
+        // argument list each time the program is executed.
+        _string_format_compile_operation ( program
+                                         , format_specifier.wildcard ? STRING_FORMAT_OPERATION_VALIDATE
+                                                                     : STRING_FORMAT_OPERATION_PRINT
+                                         , read
+                                         , format_specifier.length
+                                         , &format_specifier
+                                         );
+
+        // Update the read and write position.
+        read += format_specifier.length;
+        state.copy_start = read;
+    }
+
+    // Copy from the write position to the end of the format string.
+    state.copy_end = STRING_FORMAT_READ_LIMIT ( &state );
+    _string_format_compile_operation ( program
+                                     , STRING_FORMAT_OPERATION_COPY
+                                     , state.copy_start
+                                     , STRING_FORMAT_COPY_SIZE ( &state )
+                                     , 0
+                                     );
+    return program;
+}
+
+void
+string_format_program_destroy
+(   string_format_program_t* program
+)
+{
+    if ( !program )
+    {
+        return;
+    }
+    string_destroy ( program->format );
+    array_destroy ( program->operations );
+    memory_free ( program );
+}
+
+string_t*
+_string_format_execute
+(   const string_format_program_t*  program
+,   args_t                          args
+)
+{
+    if ( !program || ( args.arg_count && !args.args ) )
+    {
+        if ( !program )                     LOGERROR ( "_string_format_execute: Missing argument: program (compiled formatting string)." );
+        if ( args.arg_count && !args.args ) LOGERROR ( "_string_format_execute: Invalid argument: args (variadic argument list).\n\t"
+                                                       "List is null, but count indicates it should contain %u element%s."
+                                                     , args.arg_count
+                                                     , ( args.arg_count > 1 ) ? "s" : ""
+                                                     );
+        return string_create_from ( "" );
+    }
+
+    string_format_sink_t sink;
+    state_t state;
+    state.args = args;
+    state.next_arg = state.args.args;
+    state.args_remaining = state.args.arg_count;
+    state.sink = &sink;
+    state.nested = false;
+    state.compile = false;
+
+    string_format_sink_string ( &sink , _string_create ( string_length ( program->format ) + 1 ) );
+    __string_format_execute ( &state , program );
+    return sink.string;
+}
+
+string_t*
+string_format_rows
+(   const char*     format
+,   const arg_t*    rows
+,   const u64       row_count
+,   const u64       arg_stride
+)
+{
+    if ( !format || ( row_count && arg_stride && !rows ) )
+    {
+        if ( !format )                            LOGERROR ( "string_format_rows: Missing argument: format (formatting string)." );
+        if ( row_count && arg_stride && !rows )   LOGERROR ( "string_format_rows: Invalid argument: rows (argument table).\n\t"
+                                                             "Table is null, but row count indicates it should contain %u row%s."
+                                                           , row_count
+                                                           , ( row_count > 1 ) ? "s" : ""
+                                                           );
+        return string_create_from ( "" );
+    }
+
+    // Decode the format string once for all rows.
+    const u64 format_length = _string_length ( format );
+    string_format_program_t* program = _string_format_compile ( format , format_length );
+
+    string_format_sink_t sink;
+    state_t state;
+    state.args.arg_count = arg_stride;
+    state.args.types = 0;
+    state.sink = &sink;
+    state.nested = false;
+    state.compile = false;
+
+    string_format_sink_string ( &sink , _string_create ( format_length + 1 ) );
+    for ( u64 i = 0; i < row_count; ++i )
+    {
+        // Once a sample of rows has been rendered, size the output for the
+        // remaining rows (plus slack) from the average row length.
+        if ( i == STRING_FORMAT_ROWS_SAMPLE_COUNT )
+        {
+            u64 estimate = sink.length + ( sink.length / i ) * ( row_count - i );
+            estimate += estimate / 8;
+            if ( estimate + 1 > array_capacity ( sink.string ) )
+            {
+                sink.string = _array_resize ( sink.string , estimate + 1 );
+            }
+        }
+
+        state.args.args = ( arg_t* )( rows + i * arg_stride );
+        state.next_arg = state.args.args;
+        state.args_remaining = state.args.arg_count;
+        __string_format_execute ( &state , program );
+    }
+
+    string_format_program_destroy ( program );
+    return sink.string;
+}
+
+void
+__string_format_execute
+(   state_t*                        state
+,   const string_format_program_t*  program
+)
+{
+    state->format = program->format;
+    state->format_length = string_length ( program->format );
+
+    const string_format_operation_t* operations = program->operations;
+    const u64 operation_count = array_length ( operations );
+    for ( u64 i = 0; i < operation_count; ++i )
+    {
+        const string_format_operation_t* operation = &operations[ i ];
+
+        // Literal? Y/N
+        if ( operation->tag == STRING_FORMAT_OPERATION_COPY )
+        {
+            _string_format_write ( state
+                                 , operation->read
+                                 , operation->length
+                                 );
+            continue;
+        }
+
+        // Bind the format specifier to the argument list.
+        string_format_specifier_t format_specifier;
+        arg_t* const next_arg = state->next_arg;
+        const u64 args_remaining = state->args_remaining;
+        bool valid;
+        switch ( operation->tag )
+        {
+            case STRING_FORMAT_OPERATION_PRINT:
+            {
+                format_specifier = operation->format_specifier;
+                valid =    format_specifier.arg_count <= state->args_remaining
+                        && _string_format_peek_collection ( state , &format_specifier )
+                        ;
+            }
+            break;
+
+            case STRING_FORMAT_OPERATION_VALIDATE:
+            {
+                _string_format_validate_format_specifier ( state
+                                                         , operation->read + sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1
+                                                         , &format_specifier
+                                                         );
+                valid =    format_specifier.tag != STRING_FORMAT_SPECIFIER_INVALID
+                        && format_specifier.length == operation->length
+                        ;
+            }
+            break;
+
+            default:
+            {
+                valid = false;
+            }
+            break;
+        }
+
+        // Invalidated by the argument list? Y/N
+        // If so, restore any arguments consumed during validation and
+        // interpret the remainder of the format string.
+        if ( !valid )
+        {
+            state->next_arg = next_arg;
+            state->args_remaining = args_remaining;
+            state->format = operation->read;
+            state->format_length = program->format
+                                 + string_length ( program->format )
+                                 - operation->read
+                                 ;
+            __string_format ( state );
+            return;
+        }
+
+        // Parse and print the next argument according to the format specifier.
+        _string_format_parse_next_argument ( state , &format_specifier );
+    }
+}
+
+bool
+string_format_cache_startup
+(   u64     capacity
+,   u64*    memory_requirement_
+,   void*   memory
+)
+{
+    if ( cache )
+    {
+        LOGERROR ( "string_format_cache_startup: Called more than once." );
+        return false;
+    }
+
+    // Round the capacity up to a power of two number of sets.
+    u64 set_count = 1;
+    while ( set_count * STRING_FORMAT_CACHE_WAYS < capacity )
+    {
+        set_count *= 2;
+    }
+
+    const u64 memory_requirement = sizeof ( string_format_cache_t )
+                                 + sizeof ( string_format_cache_entry_t )
+                                 * set_count
+                                 * STRING_FORMAT_CACHE_WAYS
+                                 ;
+
+    if ( memory_requirement_ )
+    {
+        *memory_requirement_ = memory_requirement;
+        if ( !memory )
+        {
+            return true;
+        }
+    }
+
+    string_format_cache_t* cache_;
+    if ( memory )
+    {
+        cache_ = memory;
+        memory_clear ( cache_ , memory_requirement );
+        cache_->owns_memory = false;
+    }
+    else
+    {
+        cache_ = memory_allocate ( memory_requirement );
+        cache_->owns_memory = true;
+    }
+
+    cache_->entries = ( string_format_cache_entry_t* )( cache_ + 1 );
+    cache_->set_count = set_count;
+    cache_->stats.capacity = set_count * STRING_FORMAT_CACHE_WAYS;
+
+    cache = cache_;
+    return true;
+}
+
+bool
+string_format_cache_shutdown
+( void )
+{
+    if ( !cache )
+    {
+        return true;
+    }
+
+    // Free every cached format string.
+    for ( u64 i = 0; i < cache->stats.capacity; ++i )
+    {
+        string_format_program_destroy ( cache->entries[ i ].program );
+    }
+
+    string_format_cache_t* cache_ = cache;
+    cache = 0;
+    if ( cache_->owns_memory )
+    {
+        memory_free ( cache_ );
+    }
+    return true;
+}
+
+bool
+string_format_cache_stats
+(   string_format_cache_stats_t* stats
+)
+{
+    if ( !cache )
+    {
+        memory_clear ( stats , sizeof ( string_format_cache_stats_t ) );
+        return false;
+    }
+    _string_format_cache_lock ();
+    *stats = cache->stats;
+    _string_format_cache_unlock ();
+    return true;
+}
+
+string_format_cache_entry_t*
+_string_format_cache_fetch
+(   const char* format
+,   const u64   format_length
+)
+{
+    // Select the cache set by address and length.
+    u64 set = ( ( ( u64 ) format ) ^ format_length ) * 0x9E3779B97F4A7C15ULL;
+    set = ( set >> 32 ) & ( cache->set_count - 1 );
+    string_format_cache_entry_t* entries = &cache->entries[ set * STRING_FORMAT_CACHE_WAYS ];
+
+    _string_format_cache_lock ();
+
+    cache->timestamp += 1;
+
+    string_format_cache_entry_t* victim = 0;
+    for ( u64 i = 0; i < STRING_FORMAT_CACHE_WAYS; ++i )
+    {
+        string_format_cache_entry_t* entry = &entries[ i ];
+
+        // CASE: Empty.
+        if ( !entry->program )
+        {
+            if ( !victim || victim->program )
+            {
+                victim = entry;
+            }
+            continue;
+        }
+
+        // CASE: Same key.
+        if (   entry->format == format
+            && entry->format_length == format_length
+           )
+        {
+            // Hit? Y/N
+            if ( memory_equal ( entry->program->format , format , format_length ) )
+            {
+                cache->stats.hits += 1;
+                entry->timestamp = cache->timestamp;
+                __atomic_add_fetch ( &entry->references , 1 , __ATOMIC_RELAXED );
+                _string_format_cache_unlock ();
+                return entry;
+            }
+
+            // The address was reused for a different format string; the entry
+            // is stale, so replace it (not counted as an eviction).
+            if ( !__atomic_load_n ( &entry->references , __ATOMIC_ACQUIRE ) )
+            {
+                string_format_program_destroy ( entry->program );
+                entry->program = 0;
+                cache->stats.count -= 1;
+                victim = entry;
+                break;
+            }
+            continue;
+        }
+
+        // CASE: Different key (track the least-recently used entry).
+        if (   !__atomic_load_n ( &entry->references , __ATOMIC_ACQUIRE )
+            && (   !victim
+                || (   victim->program
+                    && entry->timestamp < victim->timestamp
+                   ))
+           )
+        {
+            victim = entry;
+        }
+    }
+
+    cache->stats.misses += 1;
+
+    // Every entry in the set is currently executing? Y/N
+    if ( !victim )
+    {
+        _string_format_cache_unlock ();
+        return 0;
+    }
+
+    // Evict? Y/N
+    if ( victim->program )
+    {
+        string_format_program_destroy ( victim->program );
+        cache->stats.evictions += 1;
+        cache->stats.count -= 1;
+    }
 
-        // Ignore? Y/N
-        if ( format_specifier.tag == STRING_FORMAT_SPECIFIER_IGNORE )
-        {
-            // Update the read and write position.
-            read += 2 * ( sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1 );
-            state->copy_start = read;
+    victim->format = format;
+    victim->format_length = format_length;
+    victim->program = _string_format_compile ( format , format_length );
+    victim->timestamp = cache->timestamp;
+    __atomic_store_n ( &victim->references , 1 , __ATOMIC_RELAXED );
+    cache->stats.count += 1;
+    _string_format_cache_unlock ();
+    return victim;
+}
 
-            // Append the token.
-            string_append ( state->string
-                          , STRING_FORMAT_SPECIFIER_TOKEN_IGNORE
-                          , sizeof ( STRING_FORMAT_SPECIFIER_TOKEN_ID ) - 1
-                          );
+INLINE
+void
+_string_format_cache_release
+(   string_format_cache_entry_t* entry
+)
+{
+    __atomic_sub_fetch ( &entry->references , 1 , __ATOMIC_RELEASE );
+}
 
-            continue;
-        }
+INLINE
+void
+_string_format_cache_lock
+( void )
+{
+    while ( __atomic_test_and_set ( &cache->lock , __ATOMIC_ACQUIRE ) )
+    {
+        // Wait without writing, so the cache line is not contended.
+        while ( __atomic_load_n ( &cache->lock , __ATOMIC_RELAXED ) );
+    }
+}
 
-        // Parse and print the next argument according to the format specifier.
-        _string_format_parse_next_argument ( state , &format_specifier );
+INLINE
+void
+_string_format_cache_unlock
+( void )
+{
+    __atomic_clear ( &cache->lock , __ATOMIC_RELEASE );
+}
 
-        // Update the read and write position.
-        read += format_specifier.length;
-        state->copy_start = read;
+void
+_string_format_compile_operation
+(   string_format_program_t*            program
+,   const STRING_FORMAT_OPERATION       tag
+,   const char*                         read
+,   const u64                           length
+,   const string_format_specifier_t*    format_specifier
+)
+{
+    // Skip empty literals.
+    if ( tag == STRING_FORMAT_OPERATION_COPY && !length )
+    {
+        return;
     }
 
-    // Copy from the write position to the end of the format string.
-    state->copy_end = STRING_FORMAT_READ_LIMIT ( state );
-    string_append ( state->string
-                  , state->copy_start
-                  , STRING_FORMAT_COPY_SIZE ( state )
-                  );
-    return state->string;
+    string_format_operation_t operation;
+    operation.tag = tag;
+    operation.read = read;
+    operation.length = length;
+    if ( format_specifier )
+    {
+        operation.format_specifier = *format_specifier;
+    }
+    else
+    {
+        memory_clear ( &operation.format_specifier , sizeof ( string_format_specifier_t ) );
+    }
+    array_push ( program->operations , operation );
 }
 
 void
@@ -577,6 +2117,7 @@ _string_format_validate_format_specifier
     format_specifier->modifier.padding.value.value = 0;
     format_specifier->modifier.padding.value.length = 0;
     format_specifier->modifier.padding.value_set_from_wildcard = false;
+    format_specifier->modifier.padding.pattern_length = 0;
     format_specifier->modifier.sign.tag = STRING_FORMAT_SIGN_NONE;
     format_specifier->modifier.radix.radix = STRING_FORMAT_DEFAULT_RADIX;
     format_specifier->modifier.fix_precision.tag = false;
@@ -585,72 +2126,22 @@ _string_format_validate_format_specifier
     format_specifier->modifier.collection.sliced = false;
     format_specifier->modifier.collection.slice.from = 0;
     format_specifier->modifier.collection.slice.to = 0;
+    format_specifier->wildcard = false;
 
     // STAGE 1: "Default" case. Determine if the token is an exact match to a
     //          format specifier, i.e. it has no modifiers.
 
     // Match against format specifier tokens.
-    for ( STRING_FORMAT_SPECIFIER i = 0
-        ; i < STRING_FORMAT_SPECIFIER_COUNT
-        ; ++i
-        )
+    const STRING_FORMAT_SPECIFIER specifier = _string_format_dispatch ( &format_specifier_dispatch
+                                                                      , format_specifiers
+                                                                      , STRING_FORMAT_SPECIFIER_COUNT
+                                                                      , read
+                                                                      , STRING_FORMAT_READ_LIMIT ( state )
+                                                                      );
+    if ( specifier != STRING_FORMAT_SPECIFIER_INVALID )
     {
-        // CASE: No match.
-        if ( read[ 0 ] != format_specifiers[ i ].value[ 0 ] )
-        {
-            continue;
-        }
-        if ( !_memory_equal ( read + 1
-                            , format_specifiers[ i ].value + 1
-                            , format_specifiers[ i ].length - 1
-                            , STRING_FORMAT_READ_LIMIT ( state )
-                            ))
-        {
-            continue;
-        }
-
-        // Handle special cases: differentiate between format specifiers
-        // which have any number of matching characters at the start of the
-        // token.
-        switch ( i )
-        {
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT:
-            {
-                if ( _memory_equal ( read
-                                   , format_specifiers[ STRING_FORMAT_SPECIFIER_FILE_INFO ].value
-                                   , format_specifiers[ STRING_FORMAT_SPECIFIER_FILE_INFO ].length
-                                   , STRING_FORMAT_READ_LIMIT ( state )
-                                   ))
-                {
-                    _string_format_validate_format_specifier_file_info ( state , &read , format_specifier );
-                    format_specifier->length += read - read_;
-                    return;
-                }
-            }
-            break;
-
-            case STRING_FORMAT_SPECIFIER_STRING:
-            {
-                if ( _memory_equal ( read
-                                   , format_specifiers[ STRING_FORMAT_SPECIFIER_BYTESIZE ].value
-                                   , format_specifiers[ STRING_FORMAT_SPECIFIER_BYTESIZE ].length
-                                   , STRING_FORMAT_READ_LIMIT ( state )
-                                   ))
-                {
-                    _string_format_validate_format_specifier_bytesize ( state , &read , format_specifier );
-                    format_specifier->length += read - read_;
-                    return;
-                }
-            }
-            break;
-
-            default:
-            {}
-            break;
-        }
-
         // CASE: Match.
-        switch ( i )
+        switch ( specifier )
         {
             case STRING_FORMAT_SPECIFIER_NESTED:                         _string_format_validate_format_specifier_nested ( state , &read , format_specifier )                         ;break;
             case STRING_FORMAT_SPECIFIER_IGNORE:                         _string_format_validate_format_specifier_ignore ( state , &read , format_specifier )                         ;break;
@@ -690,41 +2181,25 @@ _string_format_validate_format_specifier
     for ( STRING_FORMAT_MODIFIER i = 0; i < STRING_FORMAT_MODIFIER_COUNT; ++i )
     {
         // Match against the format modifier tokens.
-        for ( STRING_FORMAT_MODIFIER j = 0; j < STRING_FORMAT_MODIFIER_COUNT; ++j )
+        const STRING_FORMAT_MODIFIER modifier = _string_format_dispatch ( &format_modifier_dispatch
+                                                                        , format_modifiers
+                                                                        , STRING_FORMAT_MODIFIER_COUNT
+                                                                        , read
+                                                                        , STRING_FORMAT_READ_LIMIT ( state )
+                                                                        );
+        switch ( modifier )
         {
-            // CASE: No match.
-            if ( read[ 0 ] != format_modifiers[ j ].value[ 0 ] )
-            {
-                continue;
-            }
-            if ( !_memory_equal ( read + 1
-                                , format_modifiers[ j ].value + 1
-                                , format_modifiers[ j ].length - 1
-                                , STRING_FORMAT_READ_LIMIT ( state )
-                                ))
-            {
-                continue;
-            }
-
-            // CASE: Match.
-            bool k = false;
-            switch ( j )
-            {
-                case STRING_FORMAT_MODIFIER_PAD:             _string_format_validate_format_modifier_pad ( state , &read , true , format_specifier )                     ;k = true;break;
-                case STRING_FORMAT_MODIFIER_PAD_MINIMUM:     _string_format_validate_format_modifier_pad ( state , &read , false , format_specifier )                    ;k = true;break;
-                case STRING_FORMAT_MODIFIER_SHOW_SIGN:       _string_format_validate_format_modifier_sign ( state , &read , STRING_FORMAT_SIGN_SHOW , format_specifier ) ;k = true;break;
-                case STRING_FORMAT_MODIFIER_HIDE_SIGN:       _string_format_validate_format_modifier_sign ( state , &read , STRING_FORMAT_SIGN_HIDE , format_specifier ) ;k = true;break;
-                case STRING_FORMAT_MODIFIER_FIX_PRECISION:   _string_format_validate_format_modifier_fix_precision ( state , &read , format_specifier )                  ;k = true;break;
-                case STRING_FORMAT_MODIFIER_RADIX:           _string_format_validate_format_modifier_radix ( state , &read , format_specifier )                          ;k = true;break;
-                case STRING_FORMAT_MODIFIER_ARRAY:           _string_format_validate_format_modifier_array ( state , &read , format_specifier )                          ;k = true;break;
-                case STRING_FORMAT_MODIFIER_RESIZABLE_ARRAY: _string_format_validate_format_modifier_resizable_array ( state , &read , format_specifier )                ;k = true;break;
-                case STRING_FORMAT_MODIFIER_SLICE:           _string_format_validate_format_modifier_slice ( state , &read , format_specifier )                          ;k = true;break;
-                default:                                                                                                                                                           break;
-            }
-            if ( k )
-            {
-                break;
-            }
+            case STRING_FORMAT_MODIFIER_PAD:             _string_format_validate_format_modifier_pad ( state , &read , true , format_specifier )                     ;break;
+            case STRING_FORMAT_MODIFIER_PAD_MINIMUM:     _string_format_validate_format_modifier_pad ( state , &read , false , format_specifier )                    ;break;
+            case STRING_FORMAT_MODIFIER_SHOW_SIGN:       _string_format_validate_format_modifier_sign ( state , &read , STRING_FORMAT_SIGN_SHOW , format_specifier ) ;break;
+            case STRING_FORMAT_MODIFIER_HIDE_SIGN:       _string_format_validate_format_modifier_sign ( state , &read , STRING_FORMAT_SIGN_HIDE , format_specifier ) ;break;
+            case STRING_FORMAT_MODIFIER_FIX_PRECISION:   _string_format_validate_format_modifier_fix_precision ( state , &read , format_specifier )                  ;break;
+            case STRING_FORMAT_MODIFIER_RADIX:           _string_format_validate_format_modifier_radix ( state , &read , format_specifier )                          ;break;
+            case STRING_FORMAT_MODIFIER_SI_UNITS:        _string_format_validate_format_modifier_si_units ( state , &read , format_specifier )                       ;break;
+            case STRING_FORMAT_MODIFIER_ARRAY:           _string_format_validate_format_modifier_array ( state , &read , format_specifier )                          ;break;
+            case STRING_FORMAT_MODIFIER_RESIZABLE_ARRAY: _string_format_validate_format_modifier_resizable_array ( state , &read , format_specifier )                ;break;
+            case STRING_FORMAT_MODIFIER_SLICE:           _string_format_validate_format_modifier_slice ( state , &read , format_specifier )                          ;break;
+            default:                                                                                                                                                           break;
         }
 
         // If the format modifier was invalidated, continue validation until the
@@ -740,98 +2215,56 @@ _string_format_validate_format_specifier
         }
         
         // Match against format specifier tokens.
-        for ( STRING_FORMAT_SPECIFIER k = 0
-            ; k < STRING_FORMAT_SPECIFIER_COUNT
-            ; ++k
-            )
-        {
-            // CASE: No match.
-            if ( read[ 0 ] != format_specifiers[ k ].value[ 0 ] )
-            {
-                continue;
-            }
-            if ( !_memory_equal ( read + 1
-                                , format_specifiers[ k ].value + 1
-                                , format_specifiers[ k ].length - 1
-                                , STRING_FORMAT_READ_LIMIT ( state )
-                                ))
-            {
-                continue;
-            }
+        const STRING_FORMAT_SPECIFIER k = _string_format_dispatch ( &format_specifier_dispatch
+                                                                  , format_specifiers
+                                                                  , STRING_FORMAT_SPECIFIER_COUNT
+                                                                  , read
+                                                                  , STRING_FORMAT_READ_LIMIT ( state )
+                                                                  );
 
-            // Handle special cases: differentiate between format specifiers
-            // which have any number of matching characters at the start of the
-            // token.
-            switch ( k )
+        // CASE: No match.
+        if ( k == STRING_FORMAT_SPECIFIER_INVALID )
+        {
+            // Neither a format modifier nor a format specifier? Y/N
+            if ( modifier == STRING_FORMAT_MODIFIER_INVALID )
             {
-                case STRING_FORMAT_SPECIFIER_FLOATING_POINT:
-                {
-                    if ( _memory_equal ( read
-                                       , format_specifiers[ STRING_FORMAT_SPECIFIER_FILE_INFO ].value
-                                       , format_specifiers[ STRING_FORMAT_SPECIFIER_FILE_INFO ].length
-                                       , STRING_FORMAT_READ_LIMIT ( state )
-                                       ))
-                    {
-                        _string_format_validate_format_specifier_file_info ( state , &read , format_specifier );
-                        format_specifier->length += read - read_;
-                        return;
-                    }
-                }
-                break;
-
-                case STRING_FORMAT_SPECIFIER_STRING:
-                {
-                    if ( _memory_equal ( read
-                                       , format_specifiers[ STRING_FORMAT_SPECIFIER_BYTESIZE ].value
-                                       , format_specifiers[ STRING_FORMAT_SPECIFIER_BYTESIZE ].length
-                                       , STRING_FORMAT_READ_LIMIT ( state )
-                                       ))
-                    {
-                        _string_format_validate_format_specifier_bytesize ( state , &read , format_specifier );
-                        format_specifier->length += read - read_;
-                        return;
-                    }
-                }
-                break;
-
-                default:
-                {}
                 break;
             }
+            continue;
+        }
 
-            // CASE: Match.
-            switch ( k )
+        // CASE: Match.
+        switch ( k )
+        {
+            // CASE: Ignore.
+            case STRING_FORMAT_SPECIFIER_IGNORE:
             {
-                // CASE: Ignore.
-                case STRING_FORMAT_SPECIFIER_IGNORE:
-                {
-                    // Invalidate (modifiers not permitted).
-                    format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-                    return;
-                }
-
-                case STRING_FORMAT_SPECIFIER_NESTED:                         _string_format_validate_format_specifier_nested ( state , &read , format_specifier )                         ;break;
-                case STRING_FORMAT_SPECIFIER_RAW:                            _string_format_validate_format_specifier_raw ( state , &read , format_specifier )                            ;break;
-                case STRING_FORMAT_SPECIFIER_INTEGER:                        _string_format_validate_format_specifier_integer ( state , &read , format_specifier )                        ;break;
-                case STRING_FORMAT_SPECIFIER_FLOATING_POINT:                 _string_format_validate_format_specifier_floating_point ( state , &read , format_specifier )                 ;break;
-                case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL: _string_format_validate_format_specifier_floating_point_show_fractional ( state , &read , format_specifier ) ;break;
-                case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:     _string_format_validate_format_specifier_floating_point_abbreviated ( state , &read , format_specifier )     ;break;
-                case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY: _string_format_validate_format_specifier_floating_point_fractional_only ( state , &read , format_specifier ) ;break;
-                case STRING_FORMAT_SPECIFIER_ADDRESS:                        _string_format_validate_format_specifier_address ( state , &read , format_specifier )                        ;break;
-                case STRING_FORMAT_SPECIFIER_CHARACTER:                      _string_format_validate_format_specifier_character ( state , &read , format_specifier )                      ;break;
-                case STRING_FORMAT_SPECIFIER_STRING:                         _string_format_validate_format_specifier_string ( state , &read , format_specifier )                         ;break;
-                case STRING_FORMAT_SPECIFIER_RESIZABLE_STRING:               _string_format_validate_format_specifier_resizable_string ( state , &read , format_specifier )               ;break;
-                case STRING_FORMAT_SPECIFIER_BOOLEAN:                        _string_format_validate_format_specifier_boolean ( state , &read , format_specifier )                        ;break;
-                case STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED:              _string_format_validate_format_specifier_boolean_truncated ( state , &read , format_specifier )              ;break;
-                case STRING_FORMAT_SPECIFIER_FILE_INFO:                      _string_format_validate_format_specifier_file_info ( state , &read , format_specifier )                      ;break;
-                case STRING_FORMAT_SPECIFIER_BYTESIZE:                       _string_format_validate_format_specifier_bytesize ( state , &read , format_specifier )                       ;break;
-                default:                                                                                                                                                                   break;
+                // Invalidate (modifiers not permitted).
+                format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+                return;
             }
 
-            // Validation complete.
-            format_specifier->length += read - read_;
-            return;
+            case STRING_FORMAT_SPECIFIER_NESTED:                         _string_format_validate_format_specifier_nested ( state , &read , format_specifier )                         ;break;
+            case STRING_FORMAT_SPECIFIER_RAW:                            _string_format_validate_format_specifier_raw ( state , &read , format_specifier )                            ;break;
+            case STRING_FORMAT_SPECIFIER_INTEGER:                        _string_format_validate_format_specifier_integer ( state , &read , format_specifier )                        ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT:                 _string_format_validate_format_specifier_floating_point ( state , &read , format_specifier )                 ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL: _string_format_validate_format_specifier_floating_point_show_fractional ( state , &read , format_specifier ) ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:     _string_format_validate_format_specifier_floating_point_abbreviated ( state , &read , format_specifier )     ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY: _string_format_validate_format_specifier_floating_point_fractional_only ( state , &read , format_specifier ) ;break;
+            case STRING_FORMAT_SPECIFIER_ADDRESS:                        _string_format_validate_format_specifier_address ( state , &read , format_specifier )                        ;break;
+            case STRING_FORMAT_SPECIFIER_CHARACTER:                      _string_format_validate_format_specifier_character ( state , &read , format_specifier )                      ;break;
+            case STRING_FORMAT_SPECIFIER_STRING:                         _string_format_validate_format_specifier_string ( state , &read , format_specifier )                         ;break;
+            case STRING_FORMAT_SPECIFIER_RESIZABLE_STRING:               _string_format_validate_format_specifier_resizable_string ( state , &read , format_specifier )               ;break;
+            case STRING_FORMAT_SPECIFIER_BOOLEAN:                        _string_format_validate_format_specifier_boolean ( state , &read , format_specifier )                        ;break;
+            case STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED:              _string_format_validate_format_specifier_boolean_truncated ( state , &read , format_specifier )              ;break;
+            case STRING_FORMAT_SPECIFIER_FILE_INFO:                      _string_format_validate_format_specifier_file_info ( state , &read , format_specifier )                      ;break;
+            case STRING_FORMAT_SPECIFIER_BYTESIZE:                       _string_format_validate_format_specifier_bytesize ( state , &read , format_specifier )                       ;break;
+            default:                                                                                                                                                                   break;
         }
+
+        // Validation complete.
+        format_specifier->length += read - read_;
+        return;
     }
 
     // STAGE 3: The token did not terminate with a format specifier.
@@ -1198,30 +2631,14 @@ _string_format_validate_format_specifier_string
     if ( format_specifier->modifier.collection.tag == STRING_FORMAT_COLLECTION_NONE )
     {
         // Fill out collection info by consuming the corresponding argument.
+        // (If compiling, this is deferred until execution time).
         format_specifier->modifier.collection.tag = STRING_FORMAT_COLLECTION_STRING;
-        format_specifier->modifier.collection.string.string = *( ( char** )( state->next_arg ) );
-        format_specifier->modifier.collection.string.length = format_specifier->modifier.collection.string.string
-                                                            ? _string_length ( format_specifier->modifier.collection.string.string )
-                                                            : 0
-                                                            ;
-
-        // Slice? Y/N
-        if ( format_specifier->modifier.collection.sliced )
+        if (   !state->compile
+            && !_string_format_peek_collection ( state , format_specifier )
+           )
         {
-            // The upper slice index may now be validated since the string length was
-            // retrieved.
-            if ( format_specifier->modifier.collection.slice.to != ( ( u64 )( -1 ) ) )
-            {
-                if ( format_specifier->modifier.collection.slice.to > format_specifier->modifier.collection.string.length )
-                {
-                    format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-                    return;
-                }
-            }
-            else
-            {
-                format_specifier->modifier.collection.slice.to = format_specifier->modifier.collection.string.length;
-            }
+            format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+            return;
         }
     }
 
@@ -1257,30 +2674,14 @@ _string_format_validate_format_specifier_resizable_string
     if ( format_specifier->modifier.collection.tag == STRING_FORMAT_COLLECTION_NONE )
     {
         // Fill out collection info by consuming the corresponding argument.
+        // (If compiling, this is deferred until execution time).
         format_specifier->modifier.collection.tag = STRING_FORMAT_COLLECTION_RESIZABLE_STRING;
-        format_specifier->modifier.collection.string.string = *( ( string_t** )( state->next_arg ) );
-        format_specifier->modifier.collection.string.length = format_specifier->modifier.collection.string.string
-                                                            ? string_length ( format_specifier->modifier.collection.string.string )
-                                                            : 0
-                                                            ;
-
-        // Slice? Y/N
-        if ( format_specifier->modifier.collection.sliced )
+        if (   !state->compile
+            && !_string_format_peek_collection ( state , format_specifier )
+           )
         {
-            // The upper slice index may now be validated since the string length was
-            // retrieved.
-            if ( format_specifier->modifier.collection.slice.to != ( ( u64 )( -1 ) ) )
-            {
-                if ( format_specifier->modifier.collection.slice.to > format_specifier->modifier.collection.string.length )
-                {
-                    format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-                    return;
-                }
-            }
-            else
-            {
-                format_specifier->modifier.collection.slice.to = format_specifier->modifier.collection.string.length;
-            }
+            format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+            return;
         }
     }
 
@@ -1472,41 +2873,51 @@ _string_format_validate_format_modifier_pad
             return;
         }
 
-        // Retrieve the value of the next argument in the variadic argument list.
-        // Expects a string matching either "l" or "r".
-        char* alignment = *( ( char** )( state->next_arg ) );
-        u64 alignment_length = alignment ? _string_length ( alignment ) : 0;
-
-        // Consume the argument that was just parsed.
-        _string_format_consume_arguments ( state , 1 );
-
+        format_specifier->wildcard = true;
         *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
 
-        // CASE: Pad left.
-        if ( _memory_equal ( alignment
-                           , "l"
-                           , sizeof ( "l" ) - 1
-                           , alignment + alignment_length
-                           ))
+        // Compiling? Y/N
+        // (If so, the argument value is resolved at execution time instead).
+        if ( state->compile )
         {
             format_specifier->modifier.padding.alignment = STRING_FORMAT_ALIGNMENT_LEFT;
         }
-
-        // CASE: Pad right.
-        else if ( _memory_equal ( alignment
-                                , "r"
-                                , sizeof ( "r" ) - 1
-                                , alignment + alignment_length
-                                ))
-        {
-            format_specifier->modifier.padding.alignment = STRING_FORMAT_ALIGNMENT_RIGHT;
-        }
-        
-        // CASE: Other (invalid).
         else
         {
-            format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-            return;
+            // Retrieve the value of the next argument in the variadic argument
+            // list. Expects a string matching either "l" or "r".
+            char* alignment = *( ( char** )( state->next_arg ) );
+            u64 alignment_length = alignment ? _string_length ( alignment ) : 0;
+
+            // Consume the argument that was just parsed.
+            _string_format_consume_arguments ( state , 1 );
+
+            // CASE: Pad left.
+            if ( _memory_equal ( alignment
+                               , "l"
+                               , sizeof ( "l" ) - 1
+                               , alignment + alignment_length
+                               ))
+            {
+                format_specifier->modifier.padding.alignment = STRING_FORMAT_ALIGNMENT_LEFT;
+            }
+
+            // CASE: Pad right.
+            else if ( _memory_equal ( alignment
+                                    , "r"
+                                    , sizeof ( "r" ) - 1
+                                    , alignment + alignment_length
+                                    ))
+            {
+                format_specifier->modifier.padding.alignment = STRING_FORMAT_ALIGNMENT_RIGHT;
+            }
+            
+            // CASE: Other (invalid).
+            else
+            {
+                format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+                return;
+            }
         }
     }
 
@@ -1570,14 +2981,24 @@ _string_format_validate_format_modifier_pad
             return;
         }
 
-        // Retrieve the value of the next argument in the variadic argument list.
-        // Expects an ASCII character.
-        format_specifier->modifier.padding.value.value = ( ( char* )( state->next_arg ) );
+        format_specifier->wildcard = true;
         format_specifier->modifier.padding.value.length = 1;
         format_specifier->modifier.padding.value_set_from_wildcard = true;
 
-        // Consume the argument that was just parsed.
-        _string_format_consume_arguments ( state , 1 );
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.padding.value.value = STRING_FORMAT_MODIFIER_TOKEN_WILDCARD;
+        }
+        else
+        {
+            // Retrieve the value of the next argument in the variadic argument
+            // list. Expects an ASCII character.
+            format_specifier->modifier.padding.value.value = ( ( char* )( state->next_arg ) );
+
+            // Consume the argument that was just parsed.
+            _string_format_consume_arguments ( state , 1 );
+        }
 
         *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
     }
@@ -1616,17 +3037,28 @@ _string_format_validate_format_modifier_pad
                 return;
             }
 
-            // Retrieve the value of the next argument in the variadic argument list.
-            // Expects a null-terminated string.
-            format_specifier->modifier.padding.value.value = *( ( char** )( state->next_arg ) );
-            format_specifier->modifier.padding.value.length = format_specifier->modifier.padding.value.value
-                                                            ? _string_length ( format_specifier->modifier.padding.value.value )
-                                                            : 0
-                                                            ;
+            format_specifier->wildcard = true;
             format_specifier->modifier.padding.value_set_from_wildcard = true;
 
-            // Consume the argument that was just parsed.
-            _string_format_consume_arguments ( state , 1 );
+            // Compiling? Y/N
+            if ( state->compile )
+            {
+                format_specifier->modifier.padding.value.value = STRING_FORMAT_MODIFIER_TOKEN_WILDCARD;
+                format_specifier->modifier.padding.value.length = sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
+            }
+            else
+            {
+                // Retrieve the value of the next argument in the variadic
+                // argument list. Expects a null-terminated string.
+                format_specifier->modifier.padding.value.value = *( ( char** )( state->next_arg ) );
+                format_specifier->modifier.padding.value.length = format_specifier->modifier.padding.value.value
+                                                                ? _string_length ( format_specifier->modifier.padding.value.value )
+                                                                : 0
+                                                                ;
+
+                // Consume the argument that was just parsed.
+                _string_format_consume_arguments ( state , 1 );
+            }
 
             *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD "'" ) - 1;
         }
@@ -1696,6 +3128,29 @@ _string_format_validate_format_modifier_pad
         return;
     }
 
+    // Unescape the padding string ahead of time, if it is short enough.
+    if ( format_specifier->modifier.padding.value.length <= STRING_FORMAT_PAD_PATTERN_MAX_LENGTH )
+    {
+        const char* value = format_specifier->modifier.padding.value.value;
+        const u64 value_length = format_specifier->modifier.padding.value.length;
+        u64 length = 0;
+        for ( u64 i = 0; i < value_length; ++i )
+        {
+            // Skip the `\` token of an escaped `'` character.
+            if (   !format_specifier->modifier.padding.value_set_from_wildcard
+                && value[ i ] == '\\'
+                && i + 1 < value_length
+                && value[ i + 1 ] == '\''
+               )
+            {
+                continue;
+            }
+            format_specifier->modifier.padding.pattern[ length ] = value[ i ];
+            length += 1;
+        }
+        format_specifier->modifier.padding.pattern_length = length;
+    }
+
     // STAGE 3: Parse width.
 
     // CASE: Wildcard (from argument).
@@ -1712,14 +3167,24 @@ _string_format_validate_format_modifier_pad
             return;
         }
 
-        // Retrieve the value of the next argument in the variadic argument list.
-        // Expects an unsigned integer.
-        format_specifier->modifier.padding.width = MIN ( *( ( u64* )( state->next_arg ) )
-                                                       , ( u64 ) STRING_FORMAT_MAX_PAD_WIDTH
-                                                       );
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.padding.width = 1;
+        }
+        else
+        {
+            // Retrieve the value of the next argument in the variadic argument
+            // list. Expects an unsigned integer.
+            format_specifier->modifier.padding.width = MIN ( *( ( u64* )( state->next_arg ) )
+                                                           , ( u64 ) STRING_FORMAT_MAX_PAD_WIDTH
+                                                           );
 
-        // Consume the argument that was just parsed.
-        _string_format_consume_arguments ( state , 1 );
+            // Consume the argument that was just parsed.
+            _string_format_consume_arguments ( state , 1 );
+        }
 
         *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
     }
@@ -1889,12 +3354,22 @@ _string_format_validate_format_modifier_fix_precision
             return;
         }
 
-        // Retrieve the value of the next argument in the variadic argument list.
-        // Expects an unsigned integer.
-        format_specifier->modifier.fix_precision.precision = *( ( u64* )( state->next_arg ) );
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.fix_precision.precision = STRING_FORMAT_FLOAT_DEFAULT_PRECISION;
+        }
+        else
+        {
+            // Retrieve the value of the next argument in the variadic
+            // argument list. Expects an unsigned integer.
+            format_specifier->modifier.fix_precision.precision = *( ( u64* )( state->next_arg ) );
 
-        // Consume the argument that was just parsed.
-        _string_format_consume_arguments ( state , 1 );
+            // Consume the argument that was just parsed.
+            _string_format_consume_arguments ( state , 1 );
+        }
 
         *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
 
@@ -1907,11 +3382,12 @@ _string_format_validate_format_modifier_fix_precision
         }
     }
 
-    // CASE: No explicit precision requested (use default).
+    // CASE: No explicit precision requested (shortest round-trip
+    //       representation).
     else
     {
         format_specifier->modifier.fix_precision.tag = false;
-        format_specifier->modifier.fix_precision.precision = STRING_FORMAT_FLOAT_DEFAULT_PRECISION;
+        format_specifier->modifier.fix_precision.precision = STRING_FLOAT_SHORTEST_PRECISION;
     }
 
     // Validation complete.
@@ -1955,12 +3431,22 @@ _string_format_validate_format_modifier_radix
             return;
         }
 
-        // Retrieve the value of the next argument in the variadic argument list.
-        // Expects an unsigned integer.
-        format_specifier->modifier.radix.radix = *( ( u64* )( state->next_arg ) );
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.radix.radix = STRING_FORMAT_DEFAULT_RADIX;
+        }
+        else
+        {
+            // Retrieve the value of the next argument in the variadic
+            // argument list. Expects an unsigned integer.
+            format_specifier->modifier.radix.radix = *( ( u64* )( state->next_arg ) );
 
-        // Consume the argument that was just parsed.
-        _string_format_consume_arguments ( state , 1 );
+            // Consume the argument that was just parsed.
+            _string_format_consume_arguments ( state , 1 );
+        }
 
         *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD ) - 1;
     }
@@ -2009,7 +3495,28 @@ _string_format_validate_format_modifier_radix
 
     // Validation complete.
 
-    format_specifier->modifiers[ STRING_FORMAT_MODIFIER_RADIX ] = true;
+    format_specifier->modifiers[ STRING_FORMAT_MODIFIER_RADIX ] = true;
+}
+
+void
+_string_format_validate_format_modifier_si_units
+(   state_t*                    state
+,   const char**                read
+,   string_format_specifier_t*  format_specifier
+)
+{
+    *read += format_modifiers[ STRING_FORMAT_MODIFIER_SI_UNITS ].length;
+
+    // Already present? Y/N
+    if ( format_specifier->modifiers[ STRING_FORMAT_MODIFIER_SI_UNITS ] )
+    {
+        format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+        return;
+    }
+
+    // Validation complete.
+
+    format_specifier->modifiers[ STRING_FORMAT_MODIFIER_SI_UNITS ] = true;
 }
 
 void
@@ -2046,27 +3553,14 @@ _string_format_validate_format_modifier_array
     }
 
     // Fill out collection info by peeking the corresponding arguments.
-    format_specifier->modifier.collection.array.array = *( ( void** )( state->next_arg ) );
-    format_specifier->modifier.collection.array.length = state->next_arg[ 1 ];
-    format_specifier->modifier.collection.array.stride = state->next_arg[ 2 ];
-
-    // Slice? Y/N
-    if ( format_specifier->modifier.collection.sliced )
+    // (If compiling, this is deferred until execution time).
+    format_specifier->modifier.collection.tag = STRING_FORMAT_COLLECTION_ARRAY;
+    if (   !state->compile
+        && !_string_format_peek_collection ( state , format_specifier )
+       )
     {
-        // The upper slice index may now be validated since the array length was
-        // retrieved.
-        if ( format_specifier->modifier.collection.slice.to != ( ( u64 )( -1 ) ) )
-        {
-            if ( format_specifier->modifier.collection.slice.to > format_specifier->modifier.collection.array.length )
-            {
-                format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-                return;
-            }
-        }
-        else
-        {
-            format_specifier->modifier.collection.slice.to = format_specifier->modifier.collection.array.length;
-        }
+        format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+        return;
     }
 
     // STAGE 1: Parse default case(s), if present.
@@ -2135,15 +3629,26 @@ _string_format_validate_format_modifier_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.start_token.value = *( ( ( char** )( state->next_arg
-                                                                                       + format_specifier->arg_count
-                                                                                       )));
-        format_specifier->modifier.collection.array.start_token.length = format_specifier->modifier.collection.array.start_token.value
-                                                                       ? _string_length ( format_specifier->modifier.collection.array.start_token.value )
-                                                                       : 0
-                                                                       ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.start_token.value = "";
+            format_specifier->modifier.collection.array.start_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.start_token.value = *( ( ( char** )( state->next_arg
+                                                                                           + format_specifier->arg_count
+                                                                                           )));
+            format_specifier->modifier.collection.array.start_token.length = format_specifier->modifier.collection.array.start_token.value
+                                                                           ? _string_length ( format_specifier->modifier.collection.array.start_token.value )
+                                                                           : 0
+                                                                           ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.start_token_set_from_wildcard = true;
@@ -2218,15 +3723,26 @@ _string_format_validate_format_modifier_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.separator_token.value = *( ( ( char** )( state->next_arg
-                                                                                           + format_specifier->arg_count
-                                                                                           )));
-        format_specifier->modifier.collection.array.separator_token.length = format_specifier->modifier.collection.array.separator_token.value
-                                                                           ? _string_length ( format_specifier->modifier.collection.array.separator_token.value )
-                                                                           : 0
-                                                                           ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.separator_token.value = "";
+            format_specifier->modifier.collection.array.separator_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.separator_token.value = *( ( ( char** )( state->next_arg
+                                                                                               + format_specifier->arg_count
+                                                                                               )));
+            format_specifier->modifier.collection.array.separator_token.length = format_specifier->modifier.collection.array.separator_token.value
+                                                                               ? _string_length ( format_specifier->modifier.collection.array.separator_token.value )
+                                                                               : 0
+                                                                               ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.separator_token_set_from_wildcard = true;
@@ -2301,15 +3817,26 @@ _string_format_validate_format_modifier_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.terminator_token.value = *( ( ( char** )( state->next_arg
-                                                                                            + format_specifier->arg_count
-                                                                                            )));
-        format_specifier->modifier.collection.array.terminator_token.length = format_specifier->modifier.collection.array.terminator_token.value
-                                                                            ? _string_length ( format_specifier->modifier.collection.array.terminator_token.value )
-                                                                            : 0
-                                                                            ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.terminator_token.value = "";
+            format_specifier->modifier.collection.array.terminator_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.terminator_token.value = *( ( ( char** )( state->next_arg
+                                                                                                + format_specifier->arg_count
+                                                                                                )));
+            format_specifier->modifier.collection.array.terminator_token.length = format_specifier->modifier.collection.array.terminator_token.value
+                                                                                ? _string_length ( format_specifier->modifier.collection.array.terminator_token.value )
+                                                                                : 0
+                                                                                ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.terminator_token_set_from_wildcard = true;
@@ -2398,33 +3925,14 @@ _string_format_validate_format_modifier_resizable_array
     }
 
     // Fill out collection info by peeking the corresponding arguments.
-    format_specifier->modifier.collection.array.array = *( ( array_t** )( state->next_arg ) );
-    format_specifier->modifier.collection.array.length = format_specifier->modifier.collection.array.array
-                                                       ? array_length ( format_specifier->modifier.collection.array.array )
-                                                       : 0
-                                                       ;
-    format_specifier->modifier.collection.array.stride = format_specifier->modifier.collection.array.array
-                                                       ? array_stride ( format_specifier->modifier.collection.array.array )
-                                                       : 0
-                                                       ;
-
-    // Slice? Y/N
-    if ( format_specifier->modifier.collection.sliced )
+    // (If compiling, this is deferred until execution time).
+    format_specifier->modifier.collection.tag = STRING_FORMAT_COLLECTION_RESIZABLE_ARRAY;
+    if (   !state->compile
+        && !_string_format_peek_collection ( state , format_specifier )
+       )
     {
-        // The upper slice index may now be validated since the array length was
-        // retrieved.
-        if ( format_specifier->modifier.collection.slice.to != ( ( u64 )( -1 ) ) )
-        {
-            if ( format_specifier->modifier.collection.slice.to > format_specifier->modifier.collection.array.length )
-            {
-                format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
-                return;
-            }
-        }
-        else
-        {
-            format_specifier->modifier.collection.slice.to = format_specifier->modifier.collection.array.length;
-        }
+        format_specifier->tag = STRING_FORMAT_SPECIFIER_INVALID;
+        return;
     }
 
     // STAGE 1: Parse default case(s), if present.
@@ -2493,15 +4001,26 @@ _string_format_validate_format_modifier_resizable_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.start_token.value = *( ( ( char** )( state->next_arg
-                                                                                       + format_specifier->arg_count
-                                                                                       )));
-        format_specifier->modifier.collection.array.start_token.length = format_specifier->modifier.collection.array.start_token.value
-                                                                       ? _string_length ( format_specifier->modifier.collection.array.start_token.value )
-                                                                       : 0
-                                                                       ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.start_token.value = "";
+            format_specifier->modifier.collection.array.start_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.start_token.value = *( ( ( char** )( state->next_arg
+                                                                                           + format_specifier->arg_count
+                                                                                           )));
+            format_specifier->modifier.collection.array.start_token.length = format_specifier->modifier.collection.array.start_token.value
+                                                                           ? _string_length ( format_specifier->modifier.collection.array.start_token.value )
+                                                                           : 0
+                                                                           ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.start_token_set_from_wildcard = true;
@@ -2576,15 +4095,26 @@ _string_format_validate_format_modifier_resizable_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.separator_token.value = *( ( ( char** )( state->next_arg
-                                                                                           + format_specifier->arg_count
-                                                                                           )));
-        format_specifier->modifier.collection.array.separator_token.length = format_specifier->modifier.collection.array.separator_token.value
-                                                                           ? _string_length ( format_specifier->modifier.collection.array.separator_token.value )
-                                                                           : 0
-                                                                           ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.separator_token.value = "";
+            format_specifier->modifier.collection.array.separator_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.separator_token.value = *( ( ( char** )( state->next_arg
+                                                                                               + format_specifier->arg_count
+                                                                                               )));
+            format_specifier->modifier.collection.array.separator_token.length = format_specifier->modifier.collection.array.separator_token.value
+                                                                               ? _string_length ( format_specifier->modifier.collection.array.separator_token.value )
+                                                                               : 0
+                                                                               ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.separator_token_set_from_wildcard = true;
@@ -2659,15 +4189,26 @@ _string_format_validate_format_modifier_resizable_array
             return;
         }
 
-        // Retrieve the value of the corresponding argument in the variadic argument
-        // list. Expects a null-terminated string.
-        format_specifier->modifier.collection.array.terminator_token.value = *( ( ( char** )( state->next_arg
-                                                                                            + format_specifier->arg_count
-                                                                                            )));
-        format_specifier->modifier.collection.array.terminator_token.length = format_specifier->modifier.collection.array.terminator_token.value
-                                                                            ? _string_length ( format_specifier->modifier.collection.array.terminator_token.value )
-                                                                            : 0
-                                                                            ;
+        format_specifier->wildcard = true;
+
+        // Compiling? Y/N
+        if ( state->compile )
+        {
+            format_specifier->modifier.collection.array.terminator_token.value = "";
+            format_specifier->modifier.collection.array.terminator_token.length = 0;
+        }
+        else
+        {
+            // Retrieve the value of the corresponding argument in the
+            // variadic argument list. Expects a null-terminated string.
+            format_specifier->modifier.collection.array.terminator_token.value = *( ( ( char** )( state->next_arg
+                                                                                                + format_specifier->arg_count
+                                                                                                )));
+            format_specifier->modifier.collection.array.terminator_token.length = format_specifier->modifier.collection.array.terminator_token.value
+                                                                                ? _string_length ( format_specifier->modifier.collection.array.terminator_token.value )
+                                                                                : 0
+                                                                                ;
+        }
 
         // Account for the argument that was just parsed via wildcard.
         format_specifier->modifier.collection.array.terminator_token_set_from_wildcard = true;
@@ -2796,12 +4337,22 @@ _string_format_validate_format_modifier_slice
                 return;
             }
 
-            // Retrieve the value of the next argument in the variadic argument list.
-            // Expects an unsigned integer.
-            format_specifier->modifier.collection.slice.from = *( ( u64* )( state->next_arg ) );
+            format_specifier->wildcard = true;
 
-            // Consume the argument that was just parsed.
-            _string_format_consume_arguments ( state , 1 );
+            // Compiling? Y/N
+            if ( state->compile )
+            {
+                format_specifier->modifier.collection.slice.from = 0;
+            }
+            else
+            {
+                // Retrieve the value of the next argument in the variadic
+                // argument list. Expects an unsigned integer.
+                format_specifier->modifier.collection.slice.from = *( ( u64* )( state->next_arg ) );
+
+                // Consume the argument that was just parsed.
+                _string_format_consume_arguments ( state , 1 );
+            }
 
             *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD
                               STRING_FORMAT_MODIFIER_TOKEN_SLICE_INDEX_SEPARATOR
@@ -2922,12 +4473,22 @@ _string_format_validate_format_modifier_slice
                 return;
             }
 
-            // Retrieve the value of the next argument in the variadic argument list.
-            // Expects an unsigned integer.
-            format_specifier->modifier.collection.slice.to = *( ( u64* )( state->next_arg ) );
+            format_specifier->wildcard = true;
 
-            // Consume the argument that was just parsed.
-            _string_format_consume_arguments ( state , 1 );
+            // Compiling? Y/N
+            if ( state->compile )
+            {
+                format_specifier->modifier.collection.slice.to = ( ( u64 )( -1 ) );
+            }
+            else
+            {
+                // Retrieve the value of the next argument in the variadic
+                // argument list. Expects an unsigned integer.
+                format_specifier->modifier.collection.slice.to = *( ( u64* )( state->next_arg ) );
+
+                // Consume the argument that was just parsed.
+                _string_format_consume_arguments ( state , 1 );
+            }
 
             *read += sizeof ( STRING_FORMAT_MODIFIER_TOKEN_WILDCARD
                               STRING_FORMAT_MODIFIER_TOKEN_SLICE_END
@@ -3042,6 +4603,85 @@ _string_format_validate_format_modifier_slice
     format_specifier->modifiers[ STRING_FORMAT_MODIFIER_SLICE ] = true;
 }
 
+bool
+_string_format_peek_collection
+(   state_t*                    state
+,   string_format_specifier_t*  format_specifier
+)
+{
+    string_format_collection_t* collection = &format_specifier->modifier.collection;
+    u64 length;
+    switch ( collection->tag )
+    {
+        case STRING_FORMAT_COLLECTION_STRING:
+        {
+            collection->string.string = *( ( char** )( state->next_arg ) );
+            collection->string.length = collection->string.string
+                                      ? _string_length ( collection->string.string )
+                                      : 0
+                                      ;
+            length = collection->string.length;
+        }
+        break;
+
+        case STRING_FORMAT_COLLECTION_RESIZABLE_STRING:
+        {
+            collection->string.string = *( ( string_t** )( state->next_arg ) );
+            collection->string.length = collection->string.string
+                                      ? string_length ( collection->string.string )
+                                      : 0
+                                      ;
+            length = collection->string.length;
+        }
+        break;
+
+        case STRING_FORMAT_COLLECTION_ARRAY:
+        {
+            collection->array.array = *( ( void** )( state->next_arg ) );
+            collection->array.length = state->next_arg[ 1 ];
+            collection->array.stride = state->next_arg[ 2 ];
+            length = collection->array.length;
+        }
+        break;
+
+        case STRING_FORMAT_COLLECTION_RESIZABLE_ARRAY:
+        {
+            collection->array.array = *( ( array_t** )( state->next_arg ) );
+            collection->array.length = collection->array.array
+                                     ? array_length ( collection->array.array )
+                                     : 0
+                                     ;
+            collection->array.stride = collection->array.array
+                                     ? array_stride ( collection->array.array )
+                                     : 0
+                                     ;
+            length = collection->array.length;
+        }
+        break;
+
+        default:
+        {
+            return true;
+        }
+    }
+
+    // Slice? Y/N
+    if ( !collection->sliced )
+    {
+        return true;
+    }
+
+    // The upper slice index may now be validated since the collection length
+    // was retrieved.
+    if ( collection->slice.to == ( ( u64 )( -1 ) ) )
+    {
+        collection->slice.to = length;
+    }
+    return    collection->slice.to <= length
+           && collection->slice.from <= collection->slice.to
+           ;
+}
+
 void
 _string_format_parse_next_argument
 (   state_t*                            state
@@ -3051,6 +4691,10 @@ _string_format_parse_next_argument
     // Retrieve the value of the next argument in the variadic argument list.
     const arg_t arg = *( state->next_arg );
 
+    #if VERSION_DEBUG == 1
+    _string_format_validate_argument_types ( state , format_specifier );
+    #endif
+
     // CASE: Collection format modifier present?
     //       YES  =>  Parse and print according to collection type.
     //       NO   =>  Parse and print according to format specifier type.
@@ -3075,10 +4719,10 @@ _string_format_parse_next_argument
             case STRING_FORMAT_SPECIFIER_RAW:                            _string_format_parse_argument_raw ( state , format_specifier , ( u64 ) arg )                             ;break;
             case STRING_FORMAT_SPECIFIER_CHARACTER:                      _string_format_parse_argument_character ( state , format_specifier , ( char ) arg )                      ;break;
             case STRING_FORMAT_SPECIFIER_INTEGER:                        _string_format_parse_argument_integer ( state , format_specifier , ( i64 ) arg )                         ;break;
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT:                 _string_format_parse_argument_floating_point ( state , format_specifier , ( f64* ) arg )                 ;break;
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL: _string_format_parse_argument_floating_point_show_fractional ( state , format_specifier , ( f64* ) arg ) ;break;
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:     _string_format_parse_argument_floating_point_abbreviated ( state , format_specifier , ( f64* ) arg )     ;break;
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY: _string_format_parse_argument_floating_point_fractional_only ( state , format_specifier , ( f64* ) arg ) ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT:                 _string_format_parse_argument_floating_point ( state , format_specifier , _string_format_next_argument_f64 ( state ) )                 ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL: _string_format_parse_argument_floating_point_show_fractional ( state , format_specifier , _string_format_next_argument_f64 ( state ) ) ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:     _string_format_parse_argument_floating_point_abbreviated ( state , format_specifier , _string_format_next_argument_f64 ( state ) )     ;break;
+            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY: _string_format_parse_argument_floating_point_fractional_only ( state , format_specifier , _string_format_next_argument_f64 ( state ) ) ;break;
             case STRING_FORMAT_SPECIFIER_ADDRESS:                        _string_format_parse_argument_address ( state , format_specifier , ( void* ) arg )                       ;break;
             case STRING_FORMAT_SPECIFIER_BOOLEAN:                        _string_format_parse_argument_boolean ( state , format_specifier , ( bool ) arg )                        ;break;
             case STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED:              _string_format_parse_argument_boolean_truncated ( state , format_specifier , ( bool ) arg )              ;break;
@@ -3103,11 +4747,11 @@ _string_format_parse_argument_raw
     char string[ STRING_INTEGER_MAX_LENGTH + 1 ];
     const u8 radix = format_specifier->modifier.radix.radix;
     const u64 string_length = string_u64 ( arg , radix , string );
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3141,11 +4785,11 @@ _string_format_parse_argument_integer
     {
         string_length = string_i64 ( arg , radix , string );
     }
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3159,11 +4803,11 @@ _string_format_parse_argument_floating_point
     // null case must be handled explicitly.
     if ( !arg )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
     char string[ STRING_FLOAT_MAX_LENGTH + 1 ];
@@ -3218,11 +4862,11 @@ _string_format_parse_argument_floating_point
         }
     }
 
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3236,11 +4880,11 @@ _string_format_parse_argument_floating_point_show_fractional
     // null case must be handled explicitly.
     if ( !arg )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
     char string[ STRING_FLOAT_MAX_LENGTH + 1 ];
@@ -3279,11 +4923,11 @@ _string_format_parse_argument_floating_point_show_fractional
                                    );
     }
 
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3297,11 +4941,11 @@ _string_format_parse_argument_floating_point_abbreviated
     // null case must be handled explicitly.
     if ( !arg )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
     char string[ STRING_FLOAT_MAX_LENGTH + 1 ];
@@ -3340,11 +4984,11 @@ _string_format_parse_argument_floating_point_abbreviated
                                    );
     }
 
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3358,11 +5002,11 @@ _string_format_parse_argument_floating_point_fractional_only
     // null case must be handled explicitly.
     if ( !arg )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
     char string[ STRING_FLOAT_MAX_LENGTH + 1 ];
@@ -3417,11 +5061,11 @@ _string_format_parse_argument_floating_point_fractional_only
         string[ string_length ] = 0;
     }
     
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3441,11 +5085,11 @@ _string_format_parse_argument_address
                                          )
                             + _string_length ( prefix )
                             ;
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , string_length
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3457,17 +5101,17 @@ _string_format_parse_argument_character
 {
     if ( !whitespace ( arg ) && ( arg < 32 || arg > 126 ) )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
-    }
-    return _string_format_append ( &state->string
-                                 , &arg
-                                 , 1
-                                 , format_specifier
-                                 );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
+    }
+    return _string_format_write_padded ( state
+                                       , &arg
+                                       , 1
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3478,11 +5122,11 @@ _string_format_parse_argument_boolean
 )
 {
     const char* string = arg ? "True" : "False";
-    return _string_format_append ( &state->string
-                                 , string
-                                 , _string_length ( string )
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , _string_length ( string )
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3492,11 +5136,11 @@ _string_format_parse_argument_boolean_truncated
 ,   const bool                          arg
 )
 {
-    return _string_format_append ( &state->string
-                                 , string_char ( arg ? 'T' : 'F' )
-                                 , 1
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string_char ( arg ? 'T' : 'F' )
+                                       , 1
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3509,14 +5153,14 @@ _string_format_parse_argument_file_info
     // Null argument or file handle? Y/N
     if ( !arg || !arg->handle )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
-    const u64 old_length = string_length ( state->string );
+    const u64 old_length = state->sink->length;
 
     // CASE: Invalid file? Y/N
     if ( !arg->valid )
@@ -3529,12 +5173,12 @@ _string_format_parse_argument_file_info
                           "\n\t}\n"
                           ;
         const u64 src_length = _string_length ( src );
-        _string_format_append ( &state->string
-                              , src
-                              , src_length
-                              , format_specifier
-                              );
-        return string_length ( state->string ) - old_length;
+        _string_format_write_padded ( state
+                                    , src
+                                    , src_length
+                                    , format_specifier
+                                    );
+        return state->sink->length - old_length;
     }
 
     // Stringify file path.
@@ -3583,14 +5227,14 @@ _string_format_parse_argument_file_info
                                         , position
                                         , &position_ratio
                                         );
-    _string_format_append ( &state->string
-                          , formatted
-                          , string_length ( formatted ) 
-                          , format_specifier
-                          );
+    _string_format_write_padded ( state
+                                , formatted
+                                , string_length ( formatted ) 
+                                , format_specifier
+                                );
     string_destroy ( formatted );
 
-    return string_length ( state->string ) - old_length;
+    return state->sink->length - old_length;
 }
 
 u64
@@ -3600,71 +5244,52 @@ _string_format_parse_argument_bytesize
 ,   const u64                           arg
 )
 {
-    f64 value;
-    const char* unit = string_bytesize ( arg , &value );
-
-    char string[ STRING_FLOAT_MAX_LENGTH + 4 + 1 ];
-    i64 integer = value;
-    f64 fractional = value - integer;
-    const bool hide_sign = format_specifier->modifier.sign.tag == STRING_FORMAT_SIGN_HIDE
-                        && value < 0
-                        ;
-    const bool show_sign = format_specifier->modifier.sign.tag == STRING_FORMAT_SIGN_SHOW
-                        && value >= 0
-                        ;
-    u64 string_length;
-
-    if ( hide_sign )
-    {
-        string_length = string_f64 ( -value
-                                   , format_specifier->modifier.fix_precision.precision
-                                   , false
-                                   , string
-                                   );
-    }
-    else if ( show_sign )
-    {
-        string[ 0 ] = '+';
-        string_length = string_f64 ( value
-                                   , format_specifier->modifier.fix_precision.precision
-                                   , false
-                                   , string + 1
-                                   ) + 1;
-    }
+    const bool si = format_specifier->modifiers[ STRING_FORMAT_MODIFIER_SI_UNITS ];
+    const u8 precision = format_specifier->modifier.fix_precision.precision;
+
+    // A bytesize is never negative, so only the show-sign modifier applies.
+    char string[ STRING_BYTESIZE_MAX_LENGTH + 1 + 1 ];
+    char* write = string;
+    if ( format_specifier->modifier.sign.tag == STRING_FORMAT_SIGN_SHOW )
+    {
+        *write = '+';
+        write += 1;
+    }
+
+    // CASE: Shortest round-trip representation (no fixed precision). Only the
+    //       fractional amounts need a floating point conversion.
+    u64 divisor;
+    const char* unit = string_bytesize_unit ( arg , si , &divisor );
+    if ( precision == STRING_FLOAT_SHORTEST_PRECISION && arg % divisor )
+    {
+        write += string_f64 ( ( ( f64 ) arg ) / divisor
+                            , STRING_FLOAT_SHORTEST_PRECISION
+                            , false
+                            , write
+                            );
+        *write = ' ';
+        write += 1;
+        const u64 unit_length = _string_length ( unit );
+        memory_copy ( write , unit , unit_length );
+        write += unit_length;
+        *write = 0; // Append terminator.
+    }
+
+    // CASE: Fixed precision (integer arithmetic only).
     else
     {
-        string_length = string_f64 ( value
-                                   , format_specifier->modifier.fix_precision.precision
-                                   , false
-                                   , string
-                                   );
-    }
-
-    if ( !fractional )
-    {
-        u64 index;
-        if ( string_contains ( string , string_length
-                             , string_char ( '.' ) , 1
-                             , false
-                             , &index
-                             ))
-        {
-            string_length = index;
-        }
+        write += string_bytesize_fixed ( arg
+                                       , si
+                                       , precision
+                                       , write
+                                       );
     }
 
-    string[ string_length ] = ' ';
-    string_length += 1;
-
-    memory_copy ( string + string_length , unit , _string_length ( unit ) );
-    string_length += _string_length ( unit );
-    string[ string_length ] = 0; // Append terminator.
-
-    return _string_format_append ( &state->string
-                                 , string
-                                 , string_length
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string
+                                       , write - string
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3711,11 +5336,11 @@ _string_format_parse_argument_string
                   ;
     }
 
-    return _string_format_append ( &state->string
-                                 , string + string_from
-                                 , string_to - string_from
-                                 , format_specifier
-                                 );
+    return _string_format_write_padded ( state
+                                       , string + string_from
+                                       , string_to - string_from
+                                       , format_specifier
+                                       );
 }
 
 u64
@@ -3728,14 +5353,14 @@ _string_format_parse_argument_array
     // Null argument? Y/N
     if ( !format_specifier->modifier.collection.array.array )
     {
-        return _string_format_append ( &state->string
-                                     , ""
-                                     , 0
-                                     , format_specifier
-                                     );
+        return _string_format_write_padded ( state
+                                           , ""
+                                           , 0
+                                           , format_specifier
+                                           );
     }
 
-    const u64 old_length = string_length ( state->string );
+    const u64 old_length = state->sink->length;
 
     // Set start and end index (accounts for slice modifier).
     const u64 array_from = ( format_specifier->modifier.collection.sliced )
@@ -3782,278 +5407,439 @@ _string_format_parse_argument_array
         array_separator = format_specifier->modifier.collection.array.separator_token;
     }
 
-    // Print array start token.
-    string_append ( state->string
-                  , array_start.value
-                  , array_start.length
-                  );
-
-    // Handle escaped `|`, `[` and `]` within the array start token, if needed.
-    if ( !format_specifier->modifier.collection.array.start_token_set_from_wildcard )
+    // Strip the separator token of escape sequences once, rather than each
+    // time it is printed.
+    char separator_buffer[ STRING_FORMAT_ARRAY_SEPARATOR_MAX_LENGTH ];
+    bool separator_strip_escape = !format_specifier->modifier.collection.array.separator_token_set_from_wildcard;
+    if (   separator_strip_escape
+        && array_separator.length <= STRING_FORMAT_ARRAY_SEPARATOR_MAX_LENGTH
+       )
     {
-        char* start_token = state->string
-                          + string_length ( state->string )
-                          - array_start.length
-                          ;
-        _string_strip_escape ( start_token , "|" , start_token );
-        _string_strip_escape ( start_token , "[" , start_token );
-        _string_strip_escape ( start_token , "]" , start_token );
-        string_truncate ( state->string
-                        , string_length ( state->string )
-                        - array_start.length
-                        + _string_length ( start_token )
-                        );
+        string_format_sink_t sink_;
+        string_format_sink_buffer ( &sink_ , separator_buffer , sizeof ( separator_buffer ) );
+        string_format_sink_t* sink = state->sink;
+        state->sink = &sink_;
+        _string_format_write_token ( state , &array_separator , true );
+        state->sink = sink;
+        array_separator.value = separator_buffer;
+        array_separator.length = sink_.length;
+        separator_strip_escape = false;
+    }
+
+    // Print array start token (handles escaped `|`, `[` and `]`, if needed).
+    _string_format_write_token ( state
+                               , &array_start
+                               , !format_specifier->modifier.collection.array.start_token_set_from_wildcard
+                               );
+
+    // Stage the printed elements in a fixed-length buffer and write it to the
+    // output sink once full, rather than writing each element individually.
+    string_format_sink_t* sink = state->sink;
+    char chunk_buffer[ STRING_FORMAT_ARRAY_CHUNK_SIZE ];
+    string_format_sink_t chunk;
+    string_format_sink_buffer ( &chunk , chunk_buffer , sizeof ( chunk_buffer ) );
+
+    // CASE: Integers with no padding or sign format modifiers, and a separator
+    //       short enough to be staged alongside an element.
+    if (   (    format_specifier->tag == STRING_FORMAT_SPECIFIER_RAW
+            ||  format_specifier->tag == STRING_FORMAT_SPECIFIER_INTEGER
+           )
+        && (    format_specifier->modifier.collection.array.stride == sizeof ( u8 )
+            ||  format_specifier->modifier.collection.array.stride == sizeof ( u16 )
+            ||  format_specifier->modifier.collection.array.stride == sizeof ( u32 )
+            ||  format_specifier->modifier.collection.array.stride == sizeof ( u64 )
+           )
+        && !format_specifier->modifier.padding.tag
+        && format_specifier->modifier.sign.tag == STRING_FORMAT_SIGN_NONE
+        && !separator_strip_escape
+        && array_separator.length + STRING_INTEGER_MAX_LENGTH + 1 <= chunk.buffer.capacity
+       )
+    {
+        _string_format_parse_argument_array_integers ( format_specifier
+                                                     , &array_separator
+                                                     , sink
+                                                     , &chunk
+                                                     );
     }
 
-    // Traverse the array.
-    for ( u64 i = array_from; i < array_to; ++i )
+    // CASE: Any other element type.
+    else
     {
-        // Retrieve the array element address.
-        const void* element = ( const void* )( ( ( u64 ) format_specifier->modifier.collection.array.array )
-                                             + i * format_specifier->modifier.collection.array.stride
-                                             );
-        
-        // Attempt to parse and print the value at the address according to the
-        // format specifier and array stride.
-        switch ( format_specifier->tag )
+        const u64 stride = format_specifier->modifier.collection.array.stride;
+        const u8* element = ( const u8* )( format_specifier->modifier.collection.array.array )
+                          + array_from * stride
+                          ;
+        state->sink = &chunk;
+        for ( u64 i = array_from; i < array_to; ++i , element += stride )
         {
-            case STRING_FORMAT_SPECIFIER_RAW:
-            {
-                u64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( u8 ):  value = *( ( u8* ) element )  ;break;
-                    case sizeof ( u16 ): value = *( ( u16* ) element ) ;break;
-                    case sizeof ( u32 ): value = *( ( u32* ) element ) ;break;
-                    case sizeof ( u64 ): value = *( ( u64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_raw ( state , format_specifier , value );
-            }
-            break;
+            const u64 chunk_length = chunk.length;
 
-            case STRING_FORMAT_SPECIFIER_CHARACTER:
+            // Print array separator token (handles escaped `|`, `[` and `]`,
+            // if needed).
+            if ( i != array_from )
             {
-                const char value = *( ( char* ) element );
-                _string_format_parse_argument_character ( state , format_specifier , value );
+                _string_format_write_token ( state
+                                           , &array_separator
+                                           , separator_strip_escape
+                                           );
             }
-            break;
+            _string_format_parse_argument_array_element ( state
+                                                        , format_specifier
+                                                        , element
+                                                        );
 
-            case STRING_FORMAT_SPECIFIER_INTEGER:
+            // CASE: Element did not fit in the staging buffer.
+            if ( chunk.length > chunk.buffer.capacity )
             {
-                i64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
+                // Write out everything preceding the element, then print the
+                // element directly to the output sink instead.
+                string_format_sink_write ( sink , chunk_buffer , chunk_length );
+                chunk.length = 0;
+                state->sink = sink;
+                if ( i != array_from )
                 {
-                    case sizeof ( i8 ):  value = *( ( i8* ) element )  ;break;
-                    case sizeof ( i16 ): value = *( ( i16* ) element ) ;break;
-                    case sizeof ( i32 ): value = *( ( i32* ) element ) ;break;
-                    case sizeof ( i64 ): value = *( ( i64* ) element ) ;break;
-                    default:             value = 0                     ;break;
+                    _string_format_write_token ( state
+                                               , &array_separator
+                                               , separator_strip_escape
+                                               );
                 }
-                _string_format_parse_argument_integer ( state , format_specifier , value );
+                _string_format_parse_argument_array_element ( state
+                                                            , format_specifier
+                                                            , element
+                                                            );
+                state->sink = &chunk;
             }
-            break;
+        }
+        state->sink = sink;
+        string_format_sink_write ( sink , chunk_buffer , chunk.length );
+    }
 
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT:
+    // Print array terminator token (handles escaped `|`, `[` and `]`, if
+    // needed).
+    _string_format_write_token ( state
+                               , &array_terminator
+                               , !format_specifier->modifier.collection.array.terminator_token_set_from_wildcard
+                               );
+
+    return state->sink->length - old_length;
+}
+
+void
+_string_format_parse_argument_array_element
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+,   const void*                         element
+)
+{
+    // Attempt to parse and print the value at the address according to the
+    // format specifier and array stride.
+    switch ( format_specifier->tag )
+    {
+        case STRING_FORMAT_SPECIFIER_RAW:
+        {
+            u64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                f64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
-                    case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_floating_point ( state , format_specifier , &value );
+                case sizeof ( u8 ):  value = *( ( u8* ) element )  ;break;
+                case sizeof ( u16 ): value = *( ( u16* ) element ) ;break;
+                case sizeof ( u32 ): value = *( ( u32* ) element ) ;break;
+                case sizeof ( u64 ): value = *( ( u64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_raw ( state , format_specifier , value );
+        }
+        break;
+
+        case STRING_FORMAT_SPECIFIER_CHARACTER:
+        {
+            const char value = *( ( char* ) element );
+            _string_format_parse_argument_character ( state , format_specifier , value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL:
+        case STRING_FORMAT_SPECIFIER_INTEGER:
+        {
+            i64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                f64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
-                    case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_floating_point_show_fractional ( state , format_specifier , &value );
+                case sizeof ( i8 ):  value = *( ( i8* ) element )  ;break;
+                case sizeof ( i16 ): value = *( ( i16* ) element ) ;break;
+                case sizeof ( i32 ): value = *( ( i32* ) element ) ;break;
+                case sizeof ( i64 ): value = *( ( i64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_integer ( state , format_specifier , value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:
+        case STRING_FORMAT_SPECIFIER_FLOATING_POINT:
+        {
+            f64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                f64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
-                    case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_floating_point_abbreviated ( state , format_specifier , &value );
+                case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
+                case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_floating_point ( state , format_specifier , &value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY:
+        case STRING_FORMAT_SPECIFIER_FLOATING_POINT_SHOW_FRACTIONAL:
+        {
+            f64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                f64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
-                    case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_floating_point_fractional_only ( state , format_specifier , &value );
+                case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
+                case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_floating_point_show_fractional ( state , format_specifier , &value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_ADDRESS:
+        case STRING_FORMAT_SPECIFIER_FLOATING_POINT_ABBREVIATED:
+        {
+            f64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                void* value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( void* ): value = *( ( void** ) element );break;
-                    default:               value = 0                      ;break;
-                }
-                _string_format_parse_argument_address ( state , format_specifier , value );
+                case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
+                case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_floating_point_abbreviated ( state , format_specifier , &value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_STRING:
+        case STRING_FORMAT_SPECIFIER_FLOATING_POINT_FRACTIONAL_ONLY:
+        {
+            f64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                _string_format_parse_argument_string ( state
-                                                     , format_specifier
-                                                     , *( ( char** ) element )
-                                                     );
+                case sizeof ( f32 ): value = *( ( f32* ) element ) ;break;
+                case sizeof ( f64 ): value = *( ( f64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_floating_point_fractional_only ( state , format_specifier , &value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_RESIZABLE_STRING:
+        case STRING_FORMAT_SPECIFIER_ADDRESS:
+        {
+            void* value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                _string_format_parse_argument_string ( state
-                                                     , format_specifier
-                                                     , *( ( string_t** ) element )
-                                                     );
+                case sizeof ( void* ): value = *( ( void** ) element );break;
+                default:               value = 0                      ;break;
             }
-            break;
+            _string_format_parse_argument_address ( state , format_specifier , value );
+        }
+        break;
+
+        case STRING_FORMAT_SPECIFIER_STRING:
+        {
+            _string_format_parse_argument_string ( state
+                                                 , format_specifier
+                                                 , *( ( char** ) element )
+                                                 );
+        }
+        break;
+
+        case STRING_FORMAT_SPECIFIER_RESIZABLE_STRING:
+        {
+            _string_format_parse_argument_string ( state
+                                                 , format_specifier
+                                                 , *( ( string_t** ) element )
+                                                 );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_BOOLEAN:
+        case STRING_FORMAT_SPECIFIER_BOOLEAN:
+        {
+            bool value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                bool value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( bool ): value = *( ( bool* ) element );break;
-                    default:              value = 0                     ;break;
-                }
-                _string_format_parse_argument_boolean ( state , format_specifier , value );
+                case sizeof ( bool ): value = *( ( bool* ) element );break;
+                default:              value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_boolean ( state , format_specifier , value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED:
+        case STRING_FORMAT_SPECIFIER_BOOLEAN_TRUNCATED:
+        {
+            bool value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                bool value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( bool ): value = *( ( bool* ) element );break;
-                    default:              value = 0                     ;break;
-                }
-                _string_format_parse_argument_boolean_truncated ( state , format_specifier , value );
+                case sizeof ( bool ): value = *( ( bool* ) element );break;
+                default:              value = 0                     ;break;
             }
-            break;
+            _string_format_parse_argument_boolean_truncated ( state , format_specifier , value );
+        }
+        break;
 
-            case STRING_FORMAT_SPECIFIER_FILE_INFO:
+        case STRING_FORMAT_SPECIFIER_FILE_INFO:
+        {
+            file_t value;
+            if ( format_specifier->modifier.collection.array.stride == sizeof ( file_t ) )
             {
-                file_t value;
-                if ( format_specifier->modifier.collection.array.stride == sizeof ( file_t ) )
-                {
-                    memory_copy ( &value , element , sizeof ( file_t ) );
-                    _string_format_parse_argument_file_info ( state
-                                                            , format_specifier
-                                                            , &value
-                                                            );
-                }
-                else
-                {
-                    _string_format_parse_argument_file_info ( state
-                                                            , format_specifier
-                                                            , 0
-                                                            );
-                }
+                memory_copy ( &value , element , sizeof ( file_t ) );
+                _string_format_parse_argument_file_info ( state
+                                                        , format_specifier
+                                                        , &value
+                                                        );
             }
-            break;
-
-            case STRING_FORMAT_SPECIFIER_BYTESIZE:
+            else
             {
-                u64 value;
-                switch ( format_specifier->modifier.collection.array.stride )
-                {
-                    case sizeof ( u8 ):  value = *( ( u8* ) element )  ;break;
-                    case sizeof ( u16 ): value = *( ( u16* ) element ) ;break;
-                    case sizeof ( u32 ): value = *( ( u32* ) element ) ;break;
-                    case sizeof ( u64 ): value = *( ( u64* ) element ) ;break;
-                    default:             value = 0                     ;break;
-                }
-                _string_format_parse_argument_bytesize ( state , format_specifier , value );
+                _string_format_parse_argument_file_info ( state
+                                                        , format_specifier
+                                                        , 0
+                                                        );
             }
-            break;
-            
-            default:
-            {}
-            break;
         }
+        break;
 
-        if ( i < array_to - 1 )
+        case STRING_FORMAT_SPECIFIER_BYTESIZE:
         {
-            // Print array separator token.
-            string_append ( state->string
-                          , array_separator.value
-                          , array_separator.length
-                         );
-
-            // Handle escaped `|`, `[` and `]` within the array separator token,
-            // if needed.
-            if ( !format_specifier->modifier.collection.array.separator_token_set_from_wildcard )
+            u64 value;
+            switch ( format_specifier->modifier.collection.array.stride )
             {
-                char* separator_token = state->string
-                                      + string_length ( state->string )
-                                      - array_separator.length
-                                      ;
-                _string_strip_escape ( separator_token , "|" , separator_token );
-                _string_strip_escape ( separator_token , "[" , separator_token );
-                _string_strip_escape ( separator_token , "]" , separator_token );
-                string_truncate ( state->string
-                                , string_length ( state->string )
-                                - array_separator.length
-                                + _string_length ( separator_token )
-                                );
+                case sizeof ( u8 ):  value = *( ( u8* ) element )  ;break;
+                case sizeof ( u16 ): value = *( ( u16* ) element ) ;break;
+                case sizeof ( u32 ): value = *( ( u32* ) element ) ;break;
+                case sizeof ( u64 ): value = *( ( u64* ) element ) ;break;
+                default:             value = 0                     ;break;
             }
+            _string_format_parse_argument_bytesize ( state , format_specifier , value );
         }
+        break;
+        
+        default:
+        {}
+        break;
     }
+}
 
-    // Print array terminator token.
-    string_append ( state->string
-                  , array_terminator.value
-                  , array_terminator.length
-                  );
-
-    // Handle escaped `|`, `[` and `]` within the array terminator token, if
-    // needed.
-    if ( !format_specifier->modifier.collection.array.terminator_token_set_from_wildcard )
-    {
-        char* terminator_token = state->string
-                               + string_length ( state->string )
-                               - array_terminator.length
-                               ;
-        _string_strip_escape ( terminator_token , "|" , terminator_token );
-        _string_strip_escape ( terminator_token , "[" , terminator_token );
-        _string_strip_escape ( terminator_token , "]" , terminator_token );
-        string_truncate ( state->string
-                        , string_length ( state->string )
-                        - array_terminator.length
-                        + _string_length ( terminator_token )
-                        );
+void
+_string_format_parse_argument_array_integers
+(   const string_format_specifier_t*    format_specifier
+,   const string_format_token_t*        separator
+,   string_format_sink_t*               sink
+,   string_format_sink_t*               chunk
+)
+{
+    const u8 radix = format_specifier->modifier.radix.radix;
+    const u64 array_from = ( format_specifier->modifier.collection.sliced )
+                         ? format_specifier->modifier.collection.slice.from
+                         : 0
+                         ;
+    const u64 array_to = ( format_specifier->modifier.collection.sliced )
+                       ? format_specifier->modifier.collection.slice.to
+                       : format_specifier->modifier.collection.array.length
+                       ;
+    const u8* element = ( const u8* )( format_specifier->modifier.collection.array.array )
+                      + array_from * format_specifier->modifier.collection.array.stride
+                      ;
+
+    // One loop per element type. Each iteration writes out the staging buffer
+    // if the separator and the longest possible element may not fit.
+    #define STRING_FORMAT_ARRAY_INTEGER_KERNEL(type,convert)                            \
+        for ( u64 i = array_from; i < array_to; ++i , element += sizeof ( type ) )      \
+        {                                                                               \
+            if (   chunk->length + separator->length + STRING_INTEGER_MAX_LENGTH + 1    \
+                 > chunk->buffer.capacity                                               \
+               )                                                                        \
+            {                                                                           \
+                string_format_sink_write ( sink                                         \
+                                         , chunk->buffer.data                           \
+                                         , chunk->length                                \
+                                         );                                             \
+                chunk->length = 0;                                                      \
+            }                                                                           \
+            if ( i != array_from )                                                      \
+            {                                                                           \
+                string_format_sink_write ( chunk                                        \
+                                         , separator->value                             \
+                                         , separator->length                            \
+                                         );                                             \
+            }                                                                           \
+            chunk->length += convert ( *( ( const type* ) element )                     \
+                                     , radix                                            \
+                                     , chunk->buffer.data + chunk->length               \
+                                     );                                                 \
+        }
+
+    // 64-bit elements can be passed straight to the bulk stringify utilities
+    // (see string_u64_array); convert as many as fit in the staging buffer per
+    // call. The first element needs STRING_INTEGER_MAX_LENGTH characters, each
+    // one after it the separator as well, plus one for the terminator. Since
+    // one such element always fits in an empty staging buffer (see
+    // _string_format_parse_argument_array), count is never zero and the
+    // capacity arithmetic never underflows.
+    #define STRING_FORMAT_ARRAY_INTEGER_BULK_KERNEL(type,convert)                               \
+        for ( u64 i = array_from; i < array_to; )                                               \
+        {                                                                                       \
+            const u64 element_length = separator->length + STRING_INTEGER_MAX_LENGTH;          \
+            if ( chunk->length + element_length + 1 > chunk->buffer.capacity )                  \
+            {                                                                                   \
+                string_format_sink_write ( sink                                                 \
+                                         , chunk->buffer.data                                   \
+                                         , chunk->length                                        \
+                                         );                                                     \
+                chunk->length = 0;                                                              \
+            }                                                                                   \
+            if ( i != array_from )                                                              \
+            {                                                                                   \
+                string_format_sink_write ( chunk                                                \
+                                         , separator->value                                     \
+                                         , separator->length                                    \
+                                         );                                                     \
+            }                                                                                   \
+            const u64 count = MIN ( array_to - i                                                \
+                                  , 1 + ( chunk->buffer.capacity - chunk->length - 1            \
+                                        - STRING_INTEGER_MAX_LENGTH                             \
+                                        ) / element_length                                      \
+                                  );                                                            \
+            chunk->length += convert ( ( const type* ) element + ( i - array_from )             \
+                                     , count                                                    \
+                                     , radix                                                    \
+                                     , separator->value                                         \
+                                     , separator->length                                        \
+                                     , chunk->buffer.data + chunk->length                       \
+                                     );                                                         \
+            i += count;                                                                         \
+        }
+
+    // CASE: Unsigned.
+    if ( format_specifier->tag == STRING_FORMAT_SPECIFIER_RAW )
+    {
+        switch ( format_specifier->modifier.collection.array.stride )
+        {
+            case sizeof ( u8 ):  STRING_FORMAT_ARRAY_INTEGER_KERNEL ( u8  , string_u64 ) ;break;
+            case sizeof ( u16 ): STRING_FORMAT_ARRAY_INTEGER_KERNEL ( u16 , string_u64 ) ;break;
+            case sizeof ( u32 ): STRING_FORMAT_ARRAY_INTEGER_KERNEL ( u32 , string_u64 ) ;break;
+            case sizeof ( u64 ): STRING_FORMAT_ARRAY_INTEGER_BULK_KERNEL ( u64 , string_u64_array ) ;break;
+            default:                                                                     break;
+        }
+    }
+
+    // CASE: Signed.
+    else
+    {
+        switch ( format_specifier->modifier.collection.array.stride )
+        {
+            case sizeof ( i8 ):  STRING_FORMAT_ARRAY_INTEGER_KERNEL ( i8  , string_i64 ) ;break;
+            case sizeof ( i16 ): STRING_FORMAT_ARRAY_INTEGER_KERNEL ( i16 , string_i64 ) ;break;
+            case sizeof ( i32 ): STRING_FORMAT_ARRAY_INTEGER_KERNEL ( i32 , string_i64 ) ;break;
+            case sizeof ( i64 ): STRING_FORMAT_ARRAY_INTEGER_BULK_KERNEL ( i64 , string_i64_array ) ;break;
+            default:                                                                     break;
+        }
     }
 
-    return string_length ( state->string ) - old_length;
+    #undef STRING_FORMAT_ARRAY_INTEGER_KERNEL
+    #undef STRING_FORMAT_ARRAY_INTEGER_BULK_KERNEL
+
+    string_format_sink_write ( sink , chunk->buffer.data , chunk->length );
 }
 
 u64
@@ -4062,37 +5848,150 @@ _string_format_parse_argument_nested
 ,   const string_format_specifier_t*    format_specifier
 )
 {
-    // Generate and append the nested format substring.
+    string_format_sink_t* sink = state->sink;
+
+    // CASE: Padding required, but the sink cannot rewrite its output (file
+    //       or builder); render to a temporary string first.
+    if (   format_specifier->modifier.padding.tag
+        && (   sink->tag == STRING_FORMAT_SINK_FILE
+            || sink->tag == STRING_FORMAT_SINK_BUILDER
+           )
+       )
+    {
+        string_format_sink_t sink_;
+        string_format_sink_string ( &sink_ , string_create_local () );
+        state->sink = &sink_;
+        _string_format_render_nested ( state , format_specifier );
+        state->sink = sink;
+        const u64 length = _string_format_write_padded ( state
+                                                       , sink_.string
+                                                       , string_length ( sink_.string )
+                                                       , format_specifier
+                                                       );
+        string_destroy ( sink_.string );
+        return length;
+    }
+
+    // Render the nested format substring directly to the output sink.
+    const u64 old_length = sink->length;
+    _string_format_render_nested ( state , format_specifier );
+    const u64 length = sink->length - old_length;
+
+    // CASE: Explicit padding not required.
+    if ( !format_specifier->modifier.padding.tag )
+    {
+        return length;
+    }
+
+    // CASE: Content length exceeds specified pad width.
+    if ( format_specifier->modifier.padding.width <= length )
+    {
+        // CASE: Fix-width printing requested.
+        if ( format_specifier->modifier.padding.fixed )
+        {
+            // Truncate the output.
+            _string_format_sink_truncate ( sink
+                                         , old_length + format_specifier->modifier.padding.width
+                                         );
+            return format_specifier->modifier.padding.width;
+        }
+
+        // CASE: Min-width printing requested.
+        return length;
+    }
+
+    // Compute the amount to pad.
+    const u64 pad_width = format_specifier->modifier.padding.width - length;
+
+    // Append the padding (right padding is then complete).
+    _string_format_write_padding ( state , format_specifier , pad_width );
+
+    // CASE: Left padding required.
+    if ( format_specifier->modifier.padding.alignment == STRING_FORMAT_ALIGNMENT_LEFT )
+    {
+        // Locate the output (only the part of it which the sink retained).
+        char* data;
+        u64 retained;
+        if ( sink->tag == STRING_FORMAT_SINK_STRING )
+        {
+            data = sink->string + string_length ( sink->string ) - sink->length;
+            retained = sink->length;
+        }
+        else
+        {
+            data = sink->buffer.data;
+            retained = MIN ( sink->length , sink->buffer.capacity );
+        }
+
+        // Shift the rendered substring past the padding, then back-fill the
+        // padding in front of it.
+        if ( old_length + pad_width < retained )
+        {
+            memory_move ( data + old_length + pad_width
+                        , data + old_length
+                        , MIN ( length , retained - old_length - pad_width )
+                        );
+        }
+        if ( old_length < retained )
+        {
+            string_format_sink_t sink_;
+            string_format_sink_buffer ( &sink_
+                                      , data + old_length
+                                      , MIN ( pad_width , retained - old_length )
+                                      );
+            state->sink = &sink_;
+            _string_format_write_padding ( state , format_specifier , pad_width );
+            state->sink = sink;
+        }
+    }
+
+    return format_specifier->modifier.padding.width;
+}
+
+void
+_string_format_render_nested
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+)
+{
     state_t state_;
     state_.format = format_specifier->modifier.nested.value;
     state_.format_length = format_specifier->modifier.nested.length;
     state_.args = state->args;
     state_.next_arg = state->next_arg;
     state_.args_remaining = state->args_remaining;
-    state_.string = state_.format_length
-                  ? _string_create ( state_.format_length + 1 )
-                  : string_create ()
-                  ;
-    string_t* string = __string_format ( &state_ );
-    __string_strip_escape ( string , "{" , sizeof ( "{" ) - 1 );
-    __string_strip_escape ( string , "}" , sizeof ( "}" ) - 1 );
-    const u64 length = _string_format_append ( &state->string
-                                             , string
-                                             , string_length ( string )
-                                             , format_specifier
-                                             );
-    string_destroy ( string );
+    state_.sink = state->sink;
+    state_.nested = true;
+    state_.compile = false;
+    __string_format ( &state_ );
 
     // Update state.
     state->next_arg = state_.next_arg;
     state->args_remaining = state_.args_remaining;
+}
 
-    return length;
+void
+_string_format_sink_truncate
+(   string_format_sink_t*   sink
+,   const u64               length
+)
+{
+    if ( length >= sink->length )
+    {
+        return;
+    }
+    if ( sink->tag == STRING_FORMAT_SINK_STRING )
+    {
+        string_truncate ( sink->string
+                        , string_length ( sink->string ) - ( sink->length - length )
+                        );
+    }
+    sink->length = length;
 }
 
 u64
-_string_format_append
-(   string_t**                          string
+_string_format_write_padded
+(   state_t*                            state
 ,   const char*                         src
 ,   const u64                           src_length
 ,   const string_format_specifier_t*    format_specifier
@@ -4102,7 +6001,7 @@ _string_format_append
     if ( !format_specifier->modifier.padding.tag )
     {
         // Append the entire source string.
-        string_append ( *string , src , src_length );
+        _string_format_write ( state , src , src_length );
         return src_length;
     }
 
@@ -4113,10 +6012,10 @@ _string_format_append
         if ( format_specifier->modifier.padding.fixed )
         {
             // Truncate the source string.
-            string_append ( *string
-                          , src
-                          , format_specifier->modifier.padding.width
-                          );
+            _string_format_write ( state
+                                 , src
+                                 , format_specifier->modifier.padding.width
+                                 );
             return format_specifier->modifier.padding.width;
         }
 
@@ -4124,7 +6023,7 @@ _string_format_append
         else
         {
             // Append the entire source string.
-            string_append ( *string , src , src_length );
+            _string_format_write ( state , src , src_length );
             return src_length;
         }
     }
@@ -4135,118 +6034,189 @@ _string_format_append
     // CASE: Left padding required.
     if ( format_specifier->modifier.padding.alignment == STRING_FORMAT_ALIGNMENT_LEFT )
     {
-        u64 pad = pad_width;
-        while ( pad )
-        {
-            u64 index = 0;
-
-            // Handle multi-character padding strings with escaped `'`
-            // characters.
-            if ( !format_specifier->modifier.padding.value_set_from_wildcard )
-            {
-                u64 index_;
-                while ( string_contains ( format_specifier->modifier.padding.value.value + index
-                                        , format_specifier->modifier.padding.value.length - index
-                                        , "\\'"
-                                        , sizeof ( "\\'" ) - 1
-                                        , false
-                                        , &index_
-                                        ))
-                {
-                    // Copy everything between the previous copy end and the
-                    // multi-character escape token.
-                    const u64 size = MIN ( pad , index_ );
-                    string_append ( *string
-                                  , format_specifier->modifier.padding.value.value + index
-                                  , size
-                                  );
-                    
-                    index += index_;
-                    pad -= size;
-
-                    // Maximum pad width reached? Y/N
-                    if ( !pad )
-                    {
-                        break;
-                    }
-
-                    // Skip the `\` token and continue.
-                    index += 1;
-                }
-            }
-
-            // Copy everything between the previous copy end and the end of the
-            // padding string.
-            const u64 size = MIN ( pad
-                                 , format_specifier->modifier.padding.value.length - index
-                                 );
-            string_append ( *string
-                          , format_specifier->modifier.padding.value.value + index
-                          , size
-                          );
-
-            pad -= size;
-        }
+        _string_format_write_padding ( state , format_specifier , pad_width );
     }
 
     // Append the entire source string.
-    string_append ( *string , src , src_length );
+    _string_format_write ( state , src , src_length );
 
     // CASE: Right padding required.
     if ( format_specifier->modifier.padding.alignment == STRING_FORMAT_ALIGNMENT_RIGHT )
     {
+        _string_format_write_padding ( state , format_specifier , pad_width );
+    }
+    return format_specifier->modifier.padding.width;
+}
+
+void
+_string_format_write_padding
+(   state_t*                            state
+,   const string_format_specifier_t*    format_specifier
+,   const u64                           pad_width
+)
+{
+    const char* pattern = format_specifier->modifier.padding.pattern;
+    const u64 pattern_length = format_specifier->modifier.padding.pattern_length;
+
+    // CASE: Padding string was unescaped ahead of time.
+    if ( pattern_length )
+    {
+        // Generate as much of the padding as fits in a block, keeping the
+        // block length a multiple of the padding string length so that the
+        // block may be written repeatedly.
+        char block[ STRING_FORMAT_PAD_BLOCK_SIZE ];
+        const u64 block_length = MIN ( pad_width
+                                     , STRING_FORMAT_PAD_BLOCK_SIZE
+                                     - STRING_FORMAT_PAD_BLOCK_SIZE % pattern_length
+                                     );
+        if ( pattern_length == 1 )
+        {
+            memory_set ( block , pattern[ 0 ] , block_length );
+        }
+        else
+        {
+            u64 length = MIN ( pattern_length , block_length );
+            memory_copy ( block , pattern , length );
+            while ( length < block_length )
+            {
+                const u64 size = MIN ( length , block_length - length );
+                memory_copy ( block + length , block , size );
+                length += size;
+            }
+        }
+
         u64 pad = pad_width;
         while ( pad )
         {
-            u64 index = 0;
+            const u64 size = MIN ( pad , block_length );
+            _string_format_write ( state , block , size );
+            pad -= size;
+        }
+        return;
+    }
+
+    // CASE: Padding string must be unescaped while writing.
+    u64 pad = pad_width;
+    while ( pad )
+    {
+        u64 index = 0;
 
-            // Handle multi-character padding strings with escaped `'`
-            // characters.
-            if ( !format_specifier->modifier.padding.value_set_from_wildcard )
+        // Handle multi-character padding strings with escaped `'`
+        // characters.
+        if ( !format_specifier->modifier.padding.value_set_from_wildcard )
+        {
+            u64 index_;
+            while ( string_contains ( format_specifier->modifier.padding.value.value + index
+                                    , format_specifier->modifier.padding.value.length - index
+                                    , "\\'"
+                                    , sizeof ( "\\'" ) - 1
+                                    , false
+                                    , &index_
+                                    ))
             {
-                u64 index_;
-                while ( string_contains ( format_specifier->modifier.padding.value.value + index
-                                        , format_specifier->modifier.padding.value.length - index
-                                        , "\\'"
-                                        , sizeof ( "\\'" ) - 1
-                                        , false
-                                        , &index_
-                                        ))
-                {
-                    // Copy everything between the previous copy end and the
-                    // multi-character escape token.
-                    const u64 size = MIN ( pad , index_ );
-                    string_append ( *string
-                                  , format_specifier->modifier.padding.value.value + index
-                                  , size
-                                  );
-                    
-                    index += index_;
-                    pad -= size;
-
-                    // Maximum pad width reached? Y/N
-                    if ( !pad )
-                    {
-                        break;
-                    }
+                // Copy everything between the previous copy end and the
+                // multi-character escape token.
+                const u64 size = MIN ( pad , index_ );
+                _string_format_write ( state
+                                     , format_specifier->modifier.padding.value.value + index
+                                     , size
+                                     );
+                
+                index += index_;
+                pad -= size;
 
-                    // Skip the `\` token and continue.
-                    index += 1;
+                // Maximum pad width reached? Y/N
+                if ( !pad )
+                {
+                    break;
                 }
+
+                // Skip the `\` token and continue.
+                index += 1;
             }
+        }
 
-            // Copy everything between the previous copy end and the end of the
-            // padding string.
-            const u64 size = MIN ( pad
-                                 , format_specifier->modifier.padding.value.length - index
-                                 );
-            string_append ( *string
-                          , format_specifier->modifier.padding.value.value + index
-                          , size
-                          );
+        // Copy everything between the previous copy end and the end of the
+        // padding string.
+        const u64 size = MIN ( pad
+                             , format_specifier->modifier.padding.value.length - index
+                             );
+        _string_format_write ( state
+                             , format_specifier->modifier.padding.value.value + index
+                             , size
+                             );
 
-            pad -= size;
+        pad -= size;
+    }
+}
+
+void
+_string_format_write_token
+(   state_t*                        state
+,   const string_format_token_t*    token
+,   const bool                      strip_escape
+)
+{
+    if ( !strip_escape )
+    {
+        _string_format_write ( state , token->value , token->length );
+        return;
+    }
+
+    // Copy everything between escaped `|`, `[` and `]` characters, skipping
+    // the `\` token.
+    u64 i;
+    u64 j;
+    for ( i = 0 , j = 0; i + 1 < token->length; ++i )
+    {
+        if ( token->value[ i ] != '\\' )
+        {
+            continue;
+        }
+        if (   token->value[ i + 1 ] != '|'
+            && token->value[ i + 1 ] != '['
+            && token->value[ i + 1 ] != ']'
+           )
+        {
+            continue;
         }
+        _string_format_write ( state , token->value + j , i - j );
+        j = i + 1;
     }
-    return format_specifier->modifier.padding.width;
+    _string_format_write ( state , token->value + j , token->length - j );
+}
+
+void
+_string_format_write_literal
+(   state_t*    state
+,   const char* src
+,   const u64   src_length
+)
+{
+    if ( !state->nested )
+    {
+        _string_format_write ( state , src , src_length );
+        return;
+    }
+
+    // Copy everything between escaped `{` and `}` characters, skipping the `\`
+    // token.
+    u64 i;
+    u64 j;
+    for ( i = 0 , j = 0; i + 1 < src_length; ++i )
+    {
+        if ( src[ i ] != '\\' )
+        {
+            continue;
+        }
+        if (   src[ i + 1 ] != STRING_FORMAT_SPECIFIER_TOKEN_NESTED_BEGIN[ 0 ]
+            && src[ i + 1 ] != STRING_FORMAT_SPECIFIER_TOKEN_NESTED_END[ 0 ]
+           )
+        {
+            continue;
+        }
+        _string_format_write ( state , src + j , i - j );
+        j = i + 1;
+    }
+    _string_format_write ( state , src + j , src_length - j );
 }
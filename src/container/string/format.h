@@ -7,6 +7,9 @@
 
 #include "common.h"
 
+#include "container/string/builder.h"
+#include "platform/filesystem.h"
+
 /** @brief (see container/string.h) */
 typedef char string_t;
 
@@ -47,6 +50,7 @@ typedef enum
 ,   STRING_FORMAT_MODIFIER_HIDE_SIGN
 ,   STRING_FORMAT_MODIFIER_FIX_PRECISION
 ,   STRING_FORMAT_MODIFIER_RADIX
+,   STRING_FORMAT_MODIFIER_SI_UNITS
 ,   STRING_FORMAT_MODIFIER_ARRAY
 ,   STRING_FORMAT_MODIFIER_RESIZABLE_ARRAY
 ,   STRING_FORMAT_MODIFIER_SLICE
@@ -94,6 +98,7 @@ STRING_FORMAT_MODIFIER;
 #define STRING_FORMAT_MODIFIER_TOKEN_HIDE_SIGN                       "-"    /** @brief Format modifier: hide sign. */
 #define STRING_FORMAT_MODIFIER_TOKEN_FIX_PRECISION                   "."    /** @brief Format modifier: fix precision. */
 #define STRING_FORMAT_MODIFIER_TOKEN_RADIX                           "r"    /** @brief Format modifier: radix. */
+#define STRING_FORMAT_MODIFIER_TOKEN_SI_UNITS                        "k"    /** @brief Format modifier: SI units. */
 #define STRING_FORMAT_MODIFIER_TOKEN_ARRAY                           "a"    /** @brief Format modifier: array. */
 #define STRING_FORMAT_MODIFIER_TOKEN_RESIZABLE_ARRAY                 "A"    /** @brief Format modifier: resizable array. */
 
@@ -102,10 +107,27 @@ STRING_FORMAT_MODIFIER;
 #define STRING_FORMAT_MODIFIER_TOKEN_SLICE_END                       "]"    /** @brief Slice end. */
 #define STRING_FORMAT_MODIFIER_TOKEN_SLICE_INDEX_SEPARATOR           ":"    /** @brief Slice index separator. */
 
+/**
+ * @brief Maximum pad width (see the P and p format modifiers). A pad width
+ * supplied by wildcard is clamped to this value, which also guards against
+ * a garbage argument requesting an unbounded amount of padding.
+ * 
+ * Library build-time option: the value is only read when compiling the
+ * library, so to raise it (e.g. for wide fixed-width reports), pass
+ * -DSTRING_FORMAT_MAX_PAD_WIDTH=<width> when building the library itself.
+ * Defining it in application code has no effect.
+ */
+#ifndef STRING_FORMAT_MAX_PAD_WIDTH
+    #define STRING_FORMAT_MAX_PAD_WIDTH 65535
+#endif
+
 /**
  * @brief String format function.
  * 
- * Accepts a variadic argument list (see common/args.h).
+ * Accepts a variadic argument list (see common/args.h). With a typed argument
+ * list (see TYPED_ARGS), floating point format specifiers also accept an f32 or
+ * f64 by value, and debug builds log an error for each argument whose type does
+ * not match its format specifier.
  *
  * Uses dynamic memory allocation. Call string_destroy to free.
  * 
@@ -195,8 +217,17 @@ STRING_FORMAT_MODIFIER;
  *               Works only with floating point format specifiers: %f, %F, %e,
  *                                                                 %d, %size,
  *                                                                 %Size.
+ * - .         : Print the shortest representation which parses back to
+ *               exactly the same value (no fixed precision).
+ *               Works only with floating point format specifiers: %f, %F, %e,
+ *                                                                 %d, %size,
+ *                                                                 %Size.
  * - r<number> : Print integer in radix <number> format.
  *               Works only with integral format specifiers:       %i, %u.
+ * - k         : Print bytesize in SI units (kB, MB, GB, TB, PB, EB; powers of
+ *               1000). Default behavior is to print IEC units (KiB, MiB, GiB,
+ *               TiB, PiB, EiB; powers of 1024).
+ *               Works only with the bytesize format specifier:    %size.
  * 
  *                                COLLECTION
  * 
@@ -245,4 +276,465 @@ _string_format
         REENABLE_WARNING ()                                 \
     })
 
+/**
+ * @brief Variant of _string_format which allocates the output string exactly
+ * once.
+ *
+ * The format string is processed twice: the first pass measures the exact
+ * length of the output without writing it, and the second pass writes the
+ * output to a string allocated with exactly that capacity, with no further
+ * bounds-growth checks. This avoids repeatedly resizing the output string
+ * when it is much longer than the format string (i.e. large %s, %S or array
+ * arguments), at the cost of converting each argument twice.
+ *
+ * Produces the same output as _string_format.
+ *
+ * Uses dynamic memory allocation. Call string_destroy to free.
+ *
+ * @param format Formatting string.
+ * @param args Variadic argument list (see common/args.h).
+ * @return The formatted string.
+ */
+string_t*
+_string_format_exact
+(   const char* format
+,   args_t      args
+);
+
+/** @brief Alias for calling _string_format_exact with __VA_ARGS__. */
+#define string_format_exact(format,...)                           \
+    ({                                                            \
+        DISABLE_WARNING ( -Wint-conversion )                      \
+        _string_format_exact ( (format) , ARGS ( __VA_ARGS__ ) ); \
+        REENABLE_WARNING ()                                       \
+    })
+
+/**
+ * @brief Variant of _string_format which writes to a caller-owned buffer
+ * rather than a new resizable string.
+ *
+ * At most capacity - 1 characters are written, followed by a terminator. If
+ * the formatted string does not fit, it is truncated. The return value is
+ * always the length of the full formatted string, so truncation may be
+ * detected by comparing it against capacity; pass capacity 0 (dst may then be
+ * 0) to compute the required length only.
+ *
+ * Does not use dynamic memory allocation, except when formatting the %{} and
+ * %file format specifiers.
+ *
+ * @param dst Output buffer. Must be non-zero if capacity is non-zero.
+ * @param capacity The number of characters dst can hold, including the
+ * terminator.
+ * @param format Formatting string.
+ * @param args Variadic argument list (see common/args.h).
+ * @return The number of characters in the formatted string (excluding the
+ * terminator), regardless of whether it was truncated.
+ */
+u64
+_string_format_into
+(   char*       dst
+,   const u64   capacity
+,   const char* format
+,   args_t      args
+);
+
+/** @brief Alias for calling _string_format_into with __VA_ARGS__. */
+#define string_format_into(dst,capacity,format,...)                                   \
+    ({                                                                                \
+        DISABLE_WARNING ( -Wint-conversion )                                          \
+        _string_format_into ( (dst) , (capacity) , (format) , ARGS ( __VA_ARGS__ ) ); \
+        REENABLE_WARNING ()                                                           \
+    })
+
+/** @brief Type and instance definitions for format output sink tags. */
+typedef enum
+{
+    STRING_FORMAT_SINK_STRING
+,   STRING_FORMAT_SINK_BUFFER
+,   STRING_FORMAT_SINK_FILE
+,   STRING_FORMAT_SINK_BUILDER
+}
+STRING_FORMAT_SINK;
+
+/** @brief Buffered file sink buffer size (in characters). */
+#define STRING_FORMAT_SINK_FILE_BUFFER_SIZE 4096
+
+/**
+ * @brief Type definition for a format output sink.
+ * 
+ * STRING_FORMAT_SINK_STRING : Appends to a resizable string.
+ * STRING_FORMAT_SINK_BUFFER : Copies to a fixed-length buffer, truncating once
+ *                             capacity is reached.
+ * STRING_FORMAT_SINK_FILE   : Copies to a fixed-length buffer which is written
+ *                             to a file whenever it fills up.
+ * STRING_FORMAT_SINK_BUILDER: Appends to a chunked string builder (see
+ *                             container/string/builder.h).
+ * 
+ * Use string_format_sink_string, string_format_sink_buffer,
+ * string_format_sink_file or string_format_sink_builder to initialize.
+ */
+typedef struct
+{
+    STRING_FORMAT_SINK  tag;
+    u64                 length;
+
+    union
+    {
+        string_t*       string;
+
+        struct
+        {
+            char*       data;
+            u64         capacity;
+        }
+        buffer;
+
+        struct
+        {
+            file_t*     file;
+            bool        valid;
+            u64         buffered;
+            char        data[ STRING_FORMAT_SINK_FILE_BUFFER_SIZE ];
+        }
+        file;
+
+        string_builder_t*   builder;
+    };
+}
+string_format_sink_t;
+
+/**
+ * @brief Initializes a sink which appends to a resizable string.
+ * 
+ * The string may be reallocated while writing; once finished, retrieve it from
+ * sink->string.
+ * 
+ * @param sink The sink to initialize. Must be non-zero.
+ * @param string The resizable string to append to. Must be non-zero.
+ */
+void
+string_format_sink_string
+(   string_format_sink_t*   sink
+,   string_t*               string
+);
+
+/**
+ * @brief Initializes a sink which writes to a fixed-length buffer.
+ * 
+ * At most capacity characters are written; any further output is discarded,
+ * but still counted by sink->length. No terminator is written.
+ * 
+ * @param sink The sink to initialize. Must be non-zero.
+ * @param dst The output buffer. Must be non-zero if capacity is non-zero.
+ * @param capacity The number of characters dst can hold. Pass 0 to only count
+ * the characters.
+ */
+void
+string_format_sink_buffer
+(   string_format_sink_t*   sink
+,   char*                   dst
+,   const u64               capacity
+);
+
+/**
+ * @brief Initializes a sink which writes to a file through a buffer of
+ * STRING_FORMAT_SINK_FILE_BUFFER_SIZE characters, bounding memory usage
+ * regardless of the length of the output.
+ * 
+ * Call string_format_sink_flush once finished.
+ * 
+ * @param sink The sink to initialize. Must be non-zero.
+ * @param file The file to write to. Must be non-zero.
+ */
+void
+string_format_sink_file
+(   string_format_sink_t*   sink
+,   file_t*                 file
+);
+
+/**
+ * @brief Initializes a sink which appends to a chunked string builder (see
+ * container/string/builder.h). Unlike a STRING_FORMAT_SINK_STRING sink, output
+ * already written is never copied again as the output grows.
+ * 
+ * @param sink The sink to initialize. Must be non-zero.
+ * @param builder The builder to append to. Must be non-zero.
+ */
+void
+string_format_sink_builder
+(   string_format_sink_t*   sink
+,   string_builder_t*       builder
+);
+
+/**
+ * @brief Writes a string to a sink.
+ * 
+ * @param sink The sink to write to. Must be non-zero.
+ * @param src The string to write.
+ * @param src_length The number of characters contained by src.
+ */
+void
+string_format_sink_write
+(   string_format_sink_t*   sink
+,   const char*             src
+,   const u64               src_length
+);
+
+/**
+ * @brief Writes any output buffered by a sink to its destination. Only
+ * applies to a STRING_FORMAT_SINK_FILE sink.
+ * 
+ * @param sink The sink to flush. Must be non-zero.
+ * @return false if a file write failed at any point; true otherwise.
+ */
+bool
+string_format_sink_flush
+(   string_format_sink_t* sink
+);
+
+/**
+ * @brief Variant of _string_format which writes to a sink (see
+ * string_format_sink_t) rather than a new resizable string.
+ * 
+ * Does not use dynamic memory allocation unless the sink does, except when
+ * formatting the %{} and %file format specifiers.
+ * 
+ * @param sink The sink to write to. Must be non-zero.
+ * @param format Formatting string.
+ * @param args Variadic argument list (see common/args.h).
+ * @return The number of characters written to the sink.
+ */
+u64
+_string_format_to
+(   string_format_sink_t*   sink
+,   const char*             format
+,   args_t                  args
+);
+
+/** @brief Alias for calling _string_format_to with __VA_ARGS__. */
+#define string_format_to(sink,format,...)                                  \
+    ({                                                                     \
+        DISABLE_WARNING ( -Wint-conversion )                               \
+        _string_format_to ( (sink) , (format) , ARGS ( __VA_ARGS__ ) );    \
+        REENABLE_WARNING ()                                                \
+    })
+
+/**
+ * @brief Variant of _string_format which appends to an existing resizable
+ * string rather than creating a new one.
+ * 
+ * Uses dynamic memory allocation only if the string must grow. Building a
+ * string from many formatted pieces this way needs no intermediate strings.
+ * 
+ * @param string Address of the resizable string to append to. Must be
+ * non-zero, and must hold a non-zero string. The string may be reallocated; it
+ * is updated in place.
+ * @param format Formatting string.
+ * @param args Variadic argument list (see common/args.h).
+ * @return The number of characters appended.
+ */
+u64
+_string_format_append
+(   string_t**  string
+,   const char* format
+,   args_t      args
+);
+
+/** @brief Alias for calling _string_format_append with __VA_ARGS__. */
+#define string_format_append(string,format,...)                                \
+    ({                                                                         \
+        DISABLE_WARNING ( -Wint-conversion )                                   \
+        _string_format_append ( &(string) , (format) , ARGS ( __VA_ARGS__ ) ); \
+        REENABLE_WARNING ()                                                    \
+    })
+
+/** @brief Type declaration for a compiled format string. */
+typedef struct string_format_program_t string_format_program_t;
+
+/**
+ * @brief Compiles a format string into a reusable program.
+ *
+ * The format string is decoded once into a sequence of literal spans and
+ * pre-decoded format specifiers, so that repeated formatting with the same
+ * format string (see _string_format_execute) does not pay the parsing cost
+ * more than once. The program holds its own copy of the format string.
+ *
+ * Format specifiers which consume wildcard format modifiers are re-validated
+ * against the argument list at execution time; if any format specifier is
+ * invalidated by the argument list, the remainder of the format string is
+ * processed as it would be by _string_format. The formatted output is
+ * always identical to that of _string_format.
+ *
+ * Use string_format_compile to compile a null-terminated format string, or
+ * _string_format_compile to explicitly specify its length.
+ *
+ * Uses dynamic memory allocation. Call string_format_program_destroy to free.
+ *
+ * @param format Formatting string. Must be non-zero.
+ * @param format_length The number of characters in format.
+ * @return A compiled format string, or 0 if format is null.
+ */
+string_format_program_t*
+_string_format_compile
+(   const char* format
+,   const u64   format_length
+);
+
+#define string_format_compile(format)                                  \
+    ({                                                                 \
+        const char* format__ = (format);                               \
+        _string_format_compile ( format__                              \
+                               , format__ ? _string_length ( format__ ) \
+                                          : 0                          \
+                               );                                      \
+    })
+
+/**
+ * @brief Frees the memory used by a compiled format string.
+ *
+ * @param program The compiled format string to free.
+ */
+void
+string_format_program_destroy
+(   string_format_program_t* program
+);
+
+/**
+ * @brief Variant of _string_format which formats a compiled format string
+ * (see string_format_compile).
+ *
+ * Accepts a variadic argument list (see common/args.h).
+ *
+ * Uses dynamic memory allocation. Call string_destroy to free.
+ *
+ * @param program A compiled format string. Must be non-zero.
+ * @param args Variadic argument list (see common/args.h).
+ * @return The formatted string.
+ */
+string_t*
+_string_format_execute
+(   const string_format_program_t*  program
+,   args_t                          args
+);
+
+/** @brief Alias for calling _string_format_execute with __VA_ARGS__. */
+#define string_format_execute(program,...)                             \
+    ({                                                                 \
+        DISABLE_WARNING ( -Wint-conversion )                           \
+        _string_format_execute ( (program) , ARGS ( __VA_ARGS__ ) );   \
+        REENABLE_WARNING ()                                            \
+    })
+
+/**
+ * @brief Formats the same format string once per row of an argument table,
+ * concatenating the output of every row into a single resizable string.
+ * 
+ * The format string is compiled once (see string_format_compile) and executed
+ * once per row. Once the first few rows are rendered, the output string is
+ * sized for all remaining rows from their average length. The output of each
+ * row is identical to that of _string_format given the same arguments.
+ * 
+ * Each row is a list of arg_stride arguments, encoded as by ARGS (see
+ * common/args.h); row i begins at rows + i * arg_stride.
+ * 
+ * Uses dynamic memory allocation. Call string_destroy to free.
+ * 
+ * @param format Formatting string. Must be non-zero.
+ * @param rows The argument table. Must be non-zero if row_count and
+ * arg_stride are non-zero.
+ * @param row_count The number of rows.
+ * @param arg_stride The number of arguments in each row.
+ * @return The formatted string.
+ */
+string_t*
+string_format_rows
+(   const char*     format
+,   const arg_t*    rows
+,   const u64       row_count
+,   const u64       arg_stride
+);
+
+/** @brief Type definition for a container to hold format string cache statistics. */
+typedef struct
+{
+    u64 capacity;
+    u64 count;
+
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+}
+string_format_cache_stats_t;
+
+/**
+ * @brief Initializes the process-wide format string cache.
+ *
+ * Call string_format_cache_shutdown to terminate.
+ *
+ * While the cache is running, _string_format remembers the compiled form of
+ * each format string it is passed (see string_format_compile), keyed on the
+ * address and length of the format string. Subsequent calls with the same
+ * format string (i.e. a string literal at a given call site) skip the parsing
+ * stage. The content of the format string is verified on each hit, so a
+ * reused address holding a different format string is never mistaken for a
+ * cached one.
+ *
+ * The cache is bounded; once full, the least-recently used format string
+ * sharing a cache set with the new one is evicted.
+ *
+ * Formatting is thread-safe while the cache is running: lookups, evictions
+ * and statistics are serialized by a spinlock, and a compiled format string
+ * is never evicted while another thread is executing it. Starting up and
+ * shutting down the cache are not; call them only while no other thread may
+ * be formatting.
+ *
+ * If pre-allocating a memory buffer:
+ *   Call once to get the memory requirement; call a second time passing in a
+ *   valid memory buffer of the required size.
+ *
+ * If using implicit memory allocation:
+ *   Uses dynamic memory allocation (see platform/memory.h).
+ *
+ * Compiled format strings always use dynamic memory allocation.
+ *
+ * @param capacity The minimum number of format strings to cache. Rounded up
+ * to a power of two multiple of the cache set size.
+ * @param memory_requirement Output buffer to hold the actual number of bytes
+ * required to operate the cache. Only applicable if pre-allocating a memory
+ * buffer of the required size. Pass 0 to use implicit memory allocation.
+ * @param memory Optional pre-allocated memory buffer. Only applicable if
+ * memory is being pre-allocated. Pass 0 to read memory requirement; otherwise,
+ * pass a pre-allocated buffer of the required size.
+ * @return true on success; false otherwise.
+ */
+bool
+string_format_cache_startup
+(   u64     capacity
+,   u64*    memory_requirement
+,   void*   memory
+);
+
+/**
+ * @brief Terminates the process-wide format string cache.
+ *
+ * Frees every cached format string. Not thread-safe (see
+ * string_format_cache_startup).
+ *
+ * @return true on success; false otherwise.
+ */
+bool
+string_format_cache_shutdown
+( void );
+
+/**
+ * @brief Queries the process-wide format string cache statistics.
+ *
+ * @param stats Output buffer. Must be non-zero.
+ * @return true if the cache is running; false otherwise (stats are zeroed).
+ */
+bool
+string_format_cache_stats
+(   string_format_cache_stats_t* stats
+);
+
 #endif // STRING_FORMAT_H
\ No newline at end of file
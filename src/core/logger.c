@@ -9,6 +9,9 @@
 #include "container/string.h"
 #include "platform/memory.h"
 
+/** @brief Size in bytes of the stack buffer each log message is formatted into before it spills to the heap. */
+#define LOG_MESSAGE_BUFFER_SIZE 512
+
 /** @brief Output message prefixes. */
 static const char* log_level_prefixes[] = { LOG_LEVEL_PREFIX_FATAL
                                           , LOG_LEVEL_PREFIX_ERROR
@@ -31,12 +34,14 @@ static const char* log_level_colors[] = { LOG_LEVEL_COLOR_FATAL
 /** @brief Type definition for logger subsystem state. */
 typedef struct
 {
-    bool        initialized;
+    bool                initialized;
+
+    file_t              file;
+    const char*         filepath;
 
-    file_t      file;
-    const char* filepath;
+    string_builder_t*   builder;
 
-    bool        owns_memory;
+    bool                owns_memory;
 }
 state_t;
 
@@ -44,17 +49,15 @@ state_t;
 static state_t* state = 0;
 
 /**
- * @brief Primary implementation of print (see print).
+ * @brief Writes a null-terminated string to a print sink (see print).
  * 
- * @param file The file to print to. Must be non-zero.
- * @param string The string to print. Must be non-zero.
- * @param string_length The number of characters in the string.
+ * @param sink The sink to write to. Must be non-zero.
+ * @param string The string to write. Must be non-zero.
  */
 void
 _print
-(   file_t*         file
-,   const char*     string
-,   const u64       string_length
+(   string_format_sink_t*   sink
+,   const char*             string
 );
 
 /**
@@ -113,6 +116,7 @@ logger_startup
 
     state->initialized = false;
     state->filepath = filepath;
+    state->builder = 0;
 
     // CASE: Log file requested.
     if ( state->filepath )
@@ -176,41 +180,81 @@ logger_log
     const bool err = level < LOG_WARN;
     const bool colored = level != LOG_INFO;
 
-    string_t* raw = _string_format ( message , args );
+    // Format the message once, directly after the log level prefix required
+    // by the log file and string builder.
+    u64 buffer[ LOG_MESSAGE_BUFFER_SIZE / sizeof ( u64 ) ];
     string_t* plaintext = 0;
-    string_t* formatted = 0;
+    u64 message_start = 0;
+    if ( state && state->initialized && ( state->file.valid || state->builder ) )
+    {
+        plaintext = _string_create_in ( buffer , sizeof ( buffer ) );
+        _string_append ( plaintext , log_level_prefixes[ level ] );
+        message_start = string_length ( plaintext );
+        _string_format_append ( &plaintext , message , args );
+    }
 
-    // Write plaintext to log file.
-    if ( state && state->initialized && state->file.valid )
+    // Write ANSI-formatted text to console, unless the log elevation is
+    // silent. Unless it was already generated for the log file, the message is
+    // formatted directly to the console.
+    if ( level != LOG_SILENT )
     {
-        plaintext = _string_copy ( raw );
-        __string_strip_ansi ( plaintext );
-        _string_prepend ( plaintext , log_level_prefixes[ level ] );
-        logger_file_append ( plaintext , string_length ( plaintext ) );
+        file_t file;
+        ( err ) ? file_stderr ( &file ) : file_stdout ( &file );
+        string_format_sink_t sink;
+        string_format_sink_file ( &sink , &file );
+        _print ( &sink , ANSI_CC_RESET );
+        _print ( &sink , log_level_colors[ level ] );
+        _print ( &sink , log_level_prefixes[ level ] );
+        _print ( &sink , ( colored ) ? "" : ANSI_CC_RESET );
+        if ( plaintext )
+        {
+            string_format_sink_write ( &sink
+                                     , plaintext + message_start
+                                     , string_length ( plaintext ) - message_start
+                                     );
+        }
+        else
+        {
+            _string_format_to ( &sink , message , args );
+        }
+        string_format_sink_write ( &sink
+                                 , ANSI_CC_RESET"\n"
+                                 , sizeof ( ANSI_CC_RESET"\n" )
+                                 ); // ^ Includes terminator.
+        string_format_sink_flush ( &sink );
     }
 
-    // CASE: Silent log elevation.
-    if ( level == LOG_SILENT )
+    // Write plaintext to log file and string builder.
+    if ( plaintext )
     {
-        string_destroy ( raw );
+        __string_strip_ansi ( plaintext );
+        if ( state->file.valid )
+        {
+            logger_file_append ( plaintext , string_length ( plaintext ) );
+        }
+        if ( state->builder )
+        {
+            string_builder_append ( state->builder
+                                  , plaintext
+                                  , string_length ( plaintext )
+                                  );
+            string_builder_append ( state->builder , "\n" , 1 );
+        }
         string_destroy ( plaintext );
-        return;
     }
+}
 
-    // Write ANSI-formatted text to console.
-    formatted = string_format ( ANSI_CC_RESET"%s%s%s%S"ANSI_CC_RESET"\n"
-                              , log_level_colors[ level ]
-                              , log_level_prefixes[ level ]
-                              , ( colored ) ? "" : ANSI_CC_RESET
-                              , raw
-                              );
-    file_t file;
-    ( err ) ? file_stderr ( &file ) : file_stdout ( &file );
-    _print ( &file , formatted , string_length ( formatted ) );
-
-    string_destroy ( raw );
-    string_destroy ( plaintext );
-    string_destroy ( formatted );
+bool
+logger_builder_set
+(   string_builder_t* builder
+)
+{
+    if ( !state || !state->initialized )
+    {
+        return false;
+    }
+    state->builder = builder;
+    return true;
 }
 
 void
@@ -224,11 +268,15 @@ print
     {
         return;
     }
-    string_t* raw = _string_format ( message , args );
-    string_t* formatted = string_format ( ANSI_CC_RESET"%S"ANSI_CC_RESET  , raw );
-    _print ( file , formatted , string_length ( formatted ) );
-    string_destroy ( raw );
-    string_destroy ( formatted );
+    string_format_sink_t sink;
+    string_format_sink_file ( &sink , file );
+    _print ( &sink , ANSI_CC_RESET );
+    _string_format_to ( &sink , message , args );
+    string_format_sink_write ( &sink
+                             , ANSI_CC_RESET
+                             , sizeof ( ANSI_CC_RESET )
+                             ); // ^ Includes terminator.
+    string_format_sink_flush ( &sink );
 }
 
 void
@@ -265,17 +313,11 @@ assertf
 
 void
 _print
-(   file_t*         file
-,   const char*     string
-,   const u64       string_length
+(   string_format_sink_t*   sink
+,   const char*             string
 )
 {
-    u64 written;
-    file_write ( file
-               , ( string_length + 1 ) * sizeof ( char )
-               , string     //     ^ terminator
-               , &written
-               );
+    string_format_sink_write ( sink , string , _string_length ( string ) );
 }
 
 void
@@ -6,6 +6,7 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include "container/string/builder.h"
 #include "core/string.h"
 #include "platform/platform.h"
 #include "platform/filesystem.h"
@@ -95,6 +96,20 @@ bool
 logger_shutdown
 ( void );
 
+/**
+ * @brief Directs the logger subsystem to also append the plaintext (see
+ * string_strip_ansi) of every subsequent log message to a string builder,
+ * exactly as it is written to the log file.
+ * 
+ * @param builder The string builder to append to (see
+ * container/string/builder.h). Pass 0 to stop.
+ * @return false if the logger subsystem is not initialized; true otherwise.
+ */
+bool
+logger_builder_set
+(   string_builder_t* builder
+);
+
 /**
  * @brief Logs a message according to the logging elevation protocol.
  * 
@@ -54,14 +54,776 @@ __string_contains_reverse
 ,   u64*        index
 );
 
+/** @brief Type definition for a vector of sixteen characters (see _string_contains_mask). */
+typedef u8 string_contains_vector_t __attribute__ (( vector_size ( 16 ) ));
+
+/** @brief Minimum substring length searched for with Horspool's algorithm (see __string_contains). */
+#define STRING_CONTAINS_HORSPOOL_MIN_LENGTH 32
+
+/** @brief Number of Horspool steps between checks that the average shift still beats the vector filter (see _string_contains_horspool). */
+#define STRING_CONTAINS_HORSPOOL_PROBE_STEPS 64
+
+/**
+ * @brief Reduces the result of a sixteen-character vector comparison to two
+ * 64-bit masks, with bit 7 of byte k set if character k compared equal
+ * (characters 0-7 in mask[ 0 ], 8-15 in mask[ 1 ]; little-endian on every
+ * target).
+ * 
+ * @param block The comparison result.
+ * @param mask Output buffer for the masks.
+ */
+INLINE
+void
+_string_contains_mask
+(   const string_contains_vector_t  block
+,   u64                             mask[ 2 ]
+);
+
+/**
+ * @brief Searches a string for a single character (see __string_contains).
+ * Compares sixteen characters at a time using a compiler vector.
+ * 
+ * @param search The string to search.
+ * @param search_length The number of characters in search.
+ * @param find The character to find.
+ * @param reverse Search in reverse? Y/N
+ * @param index Output buffer to hold the index in search at which find was
+ * found.
+ * @return true if search contains find; false otherwise.
+ */
+bool
+_string_contains_character
+(   const char* search
+,   const u64   search_length
+,   const char  find
+,   const bool  reverse
+,   u64*        index
+);
+
+/**
+ * @brief Searches a string for a short substring (see __string_contains).
+ * 
+ * Filters sixteen candidate positions at a time by comparing both the first
+ * and the last character of the substring using compiler vectors; only the
+ * candidates which pass are compared in full.
+ * 
+ * @param search The string to search.
+ * @param search_length The number of characters in search.
+ * @param find The substring to find.
+ * @param find_length The number of characters in find. Must be at least 2.
+ * @param reverse Search in reverse? Y/N
+ * @param index Output buffer to hold the index in search at which find was
+ * found.
+ * @return true if search contains find; false otherwise.
+ */
+bool
+_string_contains_filter
+(   const char* search
+,   const u64   search_length
+,   const char* find
+,   const u64   find_length
+,   const bool  reverse
+,   u64*        index
+);
+
+/**
+ * @brief Searches a string for a long substring using Horspool's algorithm
+ * (see __string_contains). Sublinear on average: on a mismatch, the window
+ * skips ahead by up to the length of the substring.
+ * 
+ * On repetitive input the shifts shrink toward one character, so every
+ * STRING_CONTAINS_HORSPOOL_PROBE_STEPS steps the distance covered is checked;
+ * if the window has moved less than the vector filter would have, the rest of
+ * the string is handed to _string_contains_filter.
+ * 
+ * @param search The string to search.
+ * @param search_length The number of characters in search.
+ * @param find The substring to find.
+ * @param find_length The number of characters in find. Must be at least 2.
+ * @param reverse Search in reverse? Y/N
+ * @param index Output buffer to hold the index in search at which find was
+ * found.
+ * @return true if search contains find; false otherwise.
+ */
+bool
+_string_contains_horspool
+(   const char* search
+,   const u64   search_length
+,   const char* find
+,   const u64   find_length
+,   const bool  reverse
+,   u64*        index
+);
+
+/** @brief Digit characters for integer radices in the range [2..36] (see _string_u64). */
+static const char string_integer_digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/** @brief Two-digit lookup table for radix-10 integers (see _string_u64_radix10). */
+static const char string_integer_digit_pairs[ 200 ] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/** @brief Powers of ten representable by a 64-bit unsigned integer (see _string_u64_radix10_length). */
+static const u64 string_integer_powers_of_ten[ 20 ] = { 1ULL
+                                                       , 10ULL
+                                                       , 100ULL
+                                                       , 1000ULL
+                                                       , 10000ULL
+                                                       , 100000ULL
+                                                       , 1000000ULL
+                                                       , 10000000ULL
+                                                       , 100000000ULL
+                                                       , 1000000000ULL
+                                                       , 10000000000ULL
+                                                       , 100000000000ULL
+                                                       , 1000000000000ULL
+                                                       , 10000000000000ULL
+                                                       , 100000000000000ULL
+                                                       , 1000000000000000ULL
+                                                       , 10000000000000000ULL
+                                                       , 100000000000000000ULL
+                                                       , 1000000000000000000ULL
+                                                       , 10000000000000000000ULL
+                                                       };
+
+/** @brief Bytesize unit abbreviations, IEC then SI (see string_bytesize_unit). */
+static const char* string_bytesize_units[ 2 ][ 7 ] = { { "B" , "KiB" , "MiB" , "GiB" , "TiB" , "PiB" , "EiB" }
+                                                     , { "B" , "kB"  , "MB"  , "GB"  , "TB"  , "PB"  , "EB"  }
+                                                     };
+
+/** @brief Type definition for an unsigned 128-bit integer (see _string_f64_decimal). */
+typedef unsigned __int128 string_u128_t;
+
+/**
+ * @brief Type definition for a decimal floating point number.
+ * 
+ * The represented value is mantissa * 10^exponent.
+ */
+typedef struct
+{
+    u64 mantissa;
+    i32 exponent;
+}
+string_f64_decimal_t;
+
+// IEEE-754 binary64 layout (see _string_f64_decimal).
+#define STRING_F64_MANTISSA_BITS        52   /** @brief Number of explicit mantissa bits. */
+#define STRING_F64_EXPONENT_BITS        11   /** @brief Number of exponent bits. */
+#define STRING_F64_EXPONENT_BIAS        1023 /** @brief Exponent bias. */
+#define STRING_F64_POW5_BITS            125  /** @brief Bit width of the normalized powers of five (see _string_f64_pow5). */
+#define STRING_F64_POW5_TABLE_STRIDE    26   /** @brief Distance between stored powers of five (see _string_f64_pow5). */
+
+// Fixed notation bounds for shortest representation (see _string_f64_shortest).
+#define STRING_F64_SHORTEST_MIN_POINT   -5   /** @brief Smallest decimal point position printed in fixed notation. */
+#define STRING_F64_SHORTEST_MAX_POINT   21   /** @brief Largest decimal point position printed in fixed notation. */
+
+// Decimal to binary64 conversion (see to_f64).
+#define STRING_F64_PARSE_MAX_DIGITS         19   /** @brief Number of significant digits accumulated in a 64-bit mantissa. */
+#define STRING_F64_PARSE_EXACT_EXPONENT     22   /** @brief Largest power of ten exactly representable by a 64-bit floating point number. */
+#define STRING_F64_PARSE_MIN_EXPONENT       -342 /** @brief Smallest power of ten which can scale a mantissa to a non-zero value. */
+#define STRING_F64_PARSE_MAX_EXPONENT       308  /** @brief Largest power of ten which can scale a mantissa to a finite value. */
+#define STRING_F64_POW5_128_TABLE_STRIDE    27   /** @brief Distance between stored 128-bit powers of five (see _string_f64_pow5_128). */
+#define STRING_F64_BIG_DECIMAL_MAX_DIGITS   800  /** @brief Digit capacity of a big decimal (see string_f64_big_decimal_t). */
+#define STRING_F64_BIG_DECIMAL_MAX_SHIFT    60   /** @brief Largest bit shift applied to a big decimal at once (see _string_f64_big_decimal_shift). */
+
+/**
+ * @brief Type definition for an arbitrary-precision decimal number.
+ * 
+ * The represented value is 0.d[0]d[1]d[2]... * 10^point. Digits which do not
+ * fit are discarded, and truncated records whether any of them were non-zero.
+ */
+typedef struct
+{
+    u8      digits[ STRING_F64_BIG_DECIMAL_MAX_DIGITS ];
+    u32     digit_count;
+    i32     point;
+    bool    truncated;
+}
+string_f64_big_decimal_t;
+
+/** @brief Type definition for a vector of sixteen characters (see _string_u64_digits16). */
+typedef u8 string_u64_parse_vector_t __attribute__ (( vector_size ( 16 ) ));
+
+/** @brief Powers of five representable by a 64-bit unsigned integer (see _string_f64_pow5). */
+static const u64 string_f64_pow5[ 28 ] = { 1ULL
+                                         , 5ULL
+                                         , 25ULL
+                                         , 125ULL
+                                         , 625ULL
+                                         , 3125ULL
+                                         , 15625ULL
+                                         , 78125ULL
+                                         , 390625ULL
+                                         , 1953125ULL
+                                         , 9765625ULL
+                                         , 48828125ULL
+                                         , 244140625ULL
+                                         , 1220703125ULL
+                                         , 6103515625ULL
+                                         , 30517578125ULL
+                                         , 152587890625ULL
+                                         , 762939453125ULL
+                                         , 3814697265625ULL
+                                         , 19073486328125ULL
+                                         , 95367431640625ULL
+                                         , 476837158203125ULL
+                                         , 2384185791015625ULL
+                                         , 11920928955078125ULL
+                                         , 59604644775390625ULL
+                                         , 298023223876953125ULL
+                                         , 1490116119384765625ULL
+                                         , 7450580596923828125ULL
+                                         };
+
+/** @brief 5^(26i), normalized to 125 bits and stored as { low , high } (see _string_f64_pow5). */
+static const u64 string_f64_pow5_split[ 13 ][ 2 ] = { { 0x0000000000000000ULL , 0x1000000000000000ULL }
+                                                    , { 0x0000000000000000ULL , 0x14ADF4B7320334B9ULL }
+                                                    , { 0x0E549208B31ADB10ULL , 0x1ABA4714957D300DULL }
+                                                    , { 0x6DC6AD264D8F0866ULL , 0x1145B7E285BF98F5ULL }
+                                                    , { 0xEB1DBD923D8596CAULL , 0x1652EFDC6018A1FCULL }
+                                                    , { 0xB4C1B80B22AE923CULL , 0x1CDA62055B2D9D83ULL }
+                                                    , { 0x5BB28B4E8F7E4C30ULL , 0x12A5568B9F52F416ULL }
+                                                    , { 0xF08AED437682D4FBULL , 0x1819651531F9E78FULL }
+                                                    , { 0xB4EE134AD99BF150ULL , 0x1F25C186A6F04C28ULL }
+                                                    , { 0x16499ECB70C25F03ULL , 0x1420EB449C8842E6ULL }
+                                                    , { 0x85A56EAD360865B0ULL , 0x1A03FDE214CAF085ULL }
+                                                    , { 0x093DB1D57999890BULL , 0x10CFEB353A97DAD8ULL }
+                                                    , { 0xCF38BB735E3F36ACULL , 0x15BAAF44FA52673EULL }
+                                                    };
+
+/** @brief 2^(k+124) / 5^(26i) + 1, where k is the bit width of 5^(26i), stored as { low , high } (see _string_f64_pow5_inv). */
+static const u64 string_f64_pow5_inv_split[ 15 ][ 2 ] = { { 0x0000000000000001ULL , 0x2000000000000000ULL }
+                                                        , { 0x52A6C95FC0655034ULL , 0x18C240C4AECB13BBULL }
+                                                        , { 0x7CA8D50071DFC806ULL , 0x1327FC58DA0F6FF5ULL }
+                                                        , { 0x6520247D3556476EULL , 0x1DA48CE468E7C702ULL }
+                                                        , { 0x6139CDD76802E6E9ULL , 0x16EF5B40C2FC7779ULL }
+                                                        , { 0xF951A7FF43DE8C79ULL , 0x11BEBDF578B2F391ULL }
+                                                        , { 0x7BE8BEE8D6E957E8ULL , 0x1B758D848FAC54B0ULL }
+                                                        , { 0x8BD3F9E999A423EAULL , 0x153EDA614071A3B7ULL }
+                                                        , { 0x0848F973CB3EE3CEULL , 0x10701BD527B4978CULL }
+                                                        , { 0x153285EBB9EFBFA2ULL , 0x196FBB9BB44DB44DULL }
+                                                        , { 0xADEEE7F86C07B696ULL , 0x13AE3591F5B4D936ULL }
+                                                        , { 0x4D686A4EAF182222ULL , 0x1E74404F3DAADA91ULL }
+                                                        , { 0x98C0A106E09EBD9FULL , 0x17900EA4FDA7C257ULL }
+                                                        , { 0x8F20E37371497D0EULL , 0x123B140576D820B2ULL }
+                                                        , { 0xB043138134743D85ULL , 0x1C35F4275F7A29ADULL }
+                                                        };
+
+/** @brief Two-bit corrections which make _string_f64_pow5 exact, sixteen per word. */
+static const u32 string_f64_pow5_offsets[ 21 ] = { 0x00000000
+                                                 , 0x00000000
+                                                 , 0x00000000
+                                                 , 0x00000000
+                                                 , 0x40000000
+                                                 , 0x59695995
+                                                 , 0x55545555
+                                                 , 0x56555515
+                                                 , 0x41150504
+                                                 , 0x40555410
+                                                 , 0x44555145
+                                                 , 0x44504540
+                                                 , 0x45555550
+                                                 , 0x40004000
+                                                 , 0x96440440
+                                                 , 0x55565565
+                                                 , 0x54454045
+                                                 , 0x40154151
+                                                 , 0x55559155
+                                                 , 0x51405555
+                                                 , 0x00000105
+                                                 };
+
+/** @brief Two-bit corrections which make _string_f64_pow5_inv exact, sixteen per word. */
+static const u32 string_f64_pow5_inv_offsets[ 22 ] = { 0xA9A99AA8
+                                                     , 0x594AAA9A
+                                                     , 0x65596555
+                                                     , 0x55955869
+                                                     , 0x85565555
+                                                     , 0x966AAAAA
+                                                     , 0x555459A9
+                                                     , 0x55565599
+                                                     , 0x95555545
+                                                     , 0x98555596
+                                                     , 0xA59A99A5
+                                                     , 0xAAAA45A9
+                                                     , 0xA6BAAAA9
+                                                     , 0x95559554
+                                                     , 0x56455556
+                                                     , 0x55565A55
+                                                     , 0xA6A6A866
+                                                     , 0x4AAAAAA9
+                                                     , 0xA5966A55
+                                                     , 0x95585555
+                                                     , 0x5A595665
+                                                     , 0x00000545
+                                                     };
+
+/** @brief Powers of ten exactly representable by a 64-bit floating point number (see to_f64). */
+static const f64 string_f64_exact_powers_of_ten[ 23 ] = { 1E0
+                                                        , 1E1
+                                                        , 1E2
+                                                        , 1E3
+                                                        , 1E4
+                                                        , 1E5
+                                                        , 1E6
+                                                        , 1E7
+                                                        , 1E8
+                                                        , 1E9
+                                                        , 1E10
+                                                        , 1E11
+                                                        , 1E12
+                                                        , 1E13
+                                                        , 1E14
+                                                        , 1E15
+                                                        , 1E16
+                                                        , 1E17
+                                                        , 1E18
+                                                        , 1E19
+                                                        , 1E20
+                                                        , 1E21
+                                                        , 1E22
+                                                        };
+
+/** @brief 5^(27i-342), normalized to 128 bits and stored as { low , high } (see _string_f64_pow5_128). */
+static const u64 string_f64_pow5_128_split[ 25 ][ 2 ] = { { 0x113FAA2906A13B3FULL , 0xEEF453D6923BD65AULL }
+                                                        , { 0x999EC0BB696E840AULL , 0xC1069CD4EABE89F8ULL }
+                                                        , { 0x4EE367F9430AEC32ULL , 0x9BECCE62836AC577ULL }
+                                                        , { 0x4BF1FF9F0062BAA8ULL , 0xFBE9141915D7A922ULL }
+                                                        , { 0xA9942F5DCF7DFD09ULL , 0xCB7DDCDDA26DA268ULL }
+                                                        , { 0x52D9BE85F074E608ULL , 0xA46116538D0DEB78ULL }
+                                                        , { 0x29ECD9F40041E073ULL , 0x84C8D4DFD2C63F3BULL }
+                                                        , { 0xC80A537B0EFEFEBDULL , 0xD686619BA27255A2ULL }
+                                                        , { 0x86C16C98D2C953C6ULL , 0xAD4AB7112EB3929DULL }
+                                                        , { 0x57EB4EDB3C55B65AULL , 0x8BFBEA76C619EF36ULL }
+                                                        , { 0x25C6DA63C38DE1B0ULL , 0xE2280B6C20DD5232ULL }
+                                                        , { 0x3D607B97C5FD0D22ULL , 0xB6B00D69BB55C8D1ULL }
+                                                        , { 0x3AFF322E62439FD0ULL , 0x9392EE8E921D5D07ULL }
+                                                        , { 0x0000000000000000ULL , 0xEE6B280000000000ULL }
+                                                        , { 0x4B9F100000000000ULL , 0xC097CE7BC90715B3ULL }
+                                                        , { 0x63CC55F49F88EB2FULL , 0x9B934C3B330C8577ULL }
+                                                        , { 0x04AB48A04065C723ULL , 0xFB5878494ACE3A5FULL }
+                                                        , { 0x5CADF5BFD3072CC5ULL , 0xCB090C8001AB551CULL }
+                                                        , { 0x5F16206C9C6209A6ULL , 0xA402B9C5A8D3A6E7ULL }
+                                                        , { 0x69956135FEBADA11ULL , 0x847C9B5D7C2E09B7ULL }
+                                                        , { 0x8A71E223D8D3B074ULL , 0xD60B3BD56A5586F1ULL }
+                                                        , { 0x636CC64D1001550BULL , 0xACE73CBFDC0BFB7BULL }
+                                                        , { 0x1AD089B6C2F7548EULL , 0x8BAB8EEFB6409C1AULL }
+                                                        , { 0x5E7873F8A0396973ULL , 0xE1A63853BBD26451ULL }
+                                                        , { 0xE0133FE4ADF8E952ULL , 0xB6472E511C81471DULL }
+                                                        };
+
+/** @brief Two-bit corrections (biased by one) which make _string_f64_pow5_128 exact, sixteen per word. */
+static const u32 string_f64_pow5_128_offsets[ 41 ] = { 0x6A6AA995
+                                                     , 0x6A5A6565
+                                                     , 0x9A9A5A56
+                                                     , 0xA69A9555
+                                                     , 0x99A9AA9A
+                                                     , 0x95655556
+                                                     , 0x99A59656
+                                                     , 0x565AA95A
+                                                     , 0xEBA655A5
+                                                     , 0xAAAAAA6A
+                                                     , 0x9A6A969A
+                                                     , 0x9569A69A
+                                                     , 0xA56956AA
+                                                     , 0x595599A5
+                                                     , 0x55555555
+                                                     , 0xA595AA59
+                                                     , 0x599AA9AA
+                                                     , 0x55555555
+                                                     , 0x55555555
+                                                     , 0xAB966556
+                                                     , 0x555541FA
+                                                     , 0x44105555
+                                                     , 0x55555555
+                                                     , 0x55555555
+                                                     , 0x55555555
+                                                     , 0x99AAA555
+                                                     , 0xA9696656
+                                                     , 0xAAAA69A9
+                                                     , 0x595AAA5A
+                                                     , 0x55556AA5
+                                                     , 0x55955955
+                                                     , 0x56666555
+                                                     , 0x69A69A95
+                                                     , 0xA96AA966
+                                                     , 0xAAA9A9AA
+                                                     , 0x9AAA5A5A
+                                                     , 0xA56AAA6A
+                                                     , 0x5565565A
+                                                     , 0xA5955696
+                                                     , 0xA969AAAA
+                                                     , 0x00156AAB
+                                                     };
+
+/**
+ * @brief Computes the number of bits in 5^e.
+ * 
+ * @param e An exponent in the range [0..3528] (inclusive).
+ * @return 1 if e is 0; ceil ( log2 ( 5^e ) ) otherwise.
+ */
+INLINE
+u32
+_string_f64_pow5_bits
+(   const u32 e
+);
+
+/**
+ * @brief Computes 5^i normalized to 125 bits.
+ * 
+ * Derived from the nearest smaller stored power of five; the result is exact.
+ * 
+ * @param i An exponent in the range [0..325] (inclusive).
+ * @return The top 125 bits of 5^i.
+ */
+INLINE
+string_u128_t
+_string_f64_pow5
+(   const u32 i
+);
+
+/**
+ * @brief Computes the normalized multiplicative inverse of 5^i.
+ * 
+ * Derived from the nearest larger stored inverse; the result is exact.
+ * 
+ * @param i An exponent in the range [0..341] (inclusive).
+ * @return floor ( 2^(k+124) / 5^i ) + 1, where k is the bit width of 5^i.
+ */
+INLINE
+string_u128_t
+_string_f64_pow5_inv
+(   const u32 i
+);
+
+/**
+ * @brief Computes ( m * multiplier ) >> j for a 128-bit multiplier.
+ * 
+ * @param m A 64-bit value.
+ * @param multiplier A 128-bit multiplier.
+ * @param j Shift amount. Must be at least 64.
+ * @return The low 64 bits of the shifted product.
+ */
+INLINE
+u64
+_string_f64_mul_shift
+(   const u64           m
+,   const string_u128_t multiplier
+,   const u32           j
+);
+
+/**
+ * @brief Computes the number of times 5 divides a value.
+ * 
+ * @param value A non-zero 64-bit value.
+ * @return The multiplicity of 5 in value.
+ */
+INLINE
+u32
+_string_f64_pow5_factor
+(   u64 value
+);
+
+/**
+ * @brief Computes the shortest decimal representation which rounds back to
+ * the provided value.
+ * 
+ * Uses the Ryu algorithm: the rounding interval of value is scaled by a power
+ * of ten using 128-bit fixed point arithmetic, then digits are removed while
+ * the interval still contains a unique decimal. Ties are broken to even.
+ * 
+ * @param value A finite, positive, non-zero 64-bit floating point number.
+ * @return The shortest decimal representation of value.
+ */
+string_f64_decimal_t
+_string_f64_decimal
+(   const f64 value
+);
+
+/**
+ * @brief Implementation of string_f64 for STRING_FLOAT_SHORTEST_PRECISION
+ * (see string_f64).
+ * 
+ * @param value A finite, non-negative 64-bit floating point number.
+ * @param abbreviated Use abbreviated (scientific) notation? Y/N
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+u64
+_string_f64_shortest
+(   const f64   value
+,   bool        abbreviated
+,   char*       dst
+);
+
+/**
+ * @brief Implementation of string_f64 for standard (fixed) notation with fixed
+ * precision (see string_f64).
+ * 
+ * The value is decomposed into its IEEE-754 mantissa and exponent, and its
+ * fractional bits are scaled by 10^precision in 128-bit integer arithmetic,
+ * so the printed digits are exactly rounded (ties to even).
+ * 
+ * @param value A finite, non-negative 64-bit floating point number less than
+ * 2^63.
+ * @param precision Floating point precision in the range
+ * [0..STRING_FLOAT_MAX_PRECISION] (inclusive).
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+u64
+_string_f64_fixed
+(   const f64   value
+,   const u8    precision
+,   char*       dst
+);
+
+/**
+ * @brief Writes a fixed-point decimal number: integer, then a point, then the
+ * fraction zero-padded to exactly precision digits.
+ * 
+ * @param integer The integral part.
+ * @param fraction The fractional part, scaled by 10^precision. Must be less
+ * than 10^precision.
+ * @param precision The number of fractional digits in the range
+ * [0..STRING_FLOAT_MAX_PRECISION] (inclusive).
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+u64
+_string_fixed_point
+(   const u64       integer
+,   string_u128_t   fraction
+,   const u8        precision
+,   char*           dst
+);
+
+/**
+ * @brief Implementation of string_f64 for abbreviated (scientific) notation
+ * with fixed precision (see string_f64).
+ * 
+ * The shortest decimal representation is rounded (ties to even) to
+ * precision + 1 significant digits.
+ * 
+ * @param value A finite, positive, non-zero 64-bit floating point number.
+ * @param precision Floating point precision.
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+u64
+_string_f64_abbreviated
+(   const f64   value
+,   const u8    precision
+,   char*       dst
+);
+
+/**
+ * @brief Computes 5^q normalized to 128 bits.
+ * 
+ * Derived from the nearest smaller stored power of five; the result is exact.
+ * For negative q, this is the normalized reciprocal of 5^-q, rounded up.
+ * 
+ * @param q An exponent in the range
+ * [STRING_F64_PARSE_MIN_EXPONENT..STRING_F64_PARSE_MAX_EXPONENT] (inclusive).
+ * @return The top 128 bits of 5^q.
+ */
+INLINE
+string_u128_t
+_string_f64_pow5_128
+(   const i32 q
+);
+
+/**
+ * @brief Computes the 64-bit floating point number nearest to w * 10^q.
+ * 
+ * Uses the Eisel-Lemire algorithm: w is normalized and multiplied by a
+ * 128-bit approximation of 5^q, and the result is rounded (ties to even).
+ * 
+ * @param w A non-zero 64-bit mantissa.
+ * @param q An exponent in the range
+ * [STRING_F64_PARSE_MIN_EXPONENT..STRING_F64_PARSE_MAX_EXPONENT] (inclusive).
+ * @param bits Output buffer for the IEEE-754 representation of the result.
+ * @return true if the result is correctly rounded; false if the product was
+ * too close to a rounding boundary to decide (see _string_f64_big_decimal).
+ */
+bool
+_string_f64_eisel_lemire
+(   u64         w
+,   const i32   q
+,   u64*        bits
+);
+
+/**
+ * @brief Parses the mantissa of a decimal string as a big decimal.
+ * 
+ * @param mantissa A string of digits with at most one point.
+ * @param mantissa_length The number of characters in mantissa.
+ * @param exponent The power of ten which scales the mantissa.
+ * @param decimal Output buffer for big decimal.
+ */
+void
+_string_f64_big_decimal
+(   const char*                 mantissa
+,   const u64                   mantissa_length
+,   const i64                   exponent
+,   string_f64_big_decimal_t*   decimal
+);
+
+/**
+ * @brief Multiplies a big decimal by 2^shift.
+ * 
+ * @param decimal A big decimal.
+ * @param shift Left shift if positive; right shift if negative.
+ */
+void
+_string_f64_big_decimal_shift
+(   string_f64_big_decimal_t*   decimal
+,   i32                         shift
+);
+
+/**
+ * @brief Computes the 64-bit floating point number nearest to a big decimal.
+ * 
+ * This is the exact fallback for _string_f64_eisel_lemire. The decimal is
+ * shifted by powers of two until it lies in [0.5..1), then the top 53 bits
+ * are extracted and rounded (ties to even).
+ * 
+ * @param decimal A big decimal. Modified in place.
+ * @return The IEEE-754 representation of the result.
+ */
+u64
+_string_f64_big_decimal_bits
+(   string_f64_big_decimal_t* decimal
+);
+
+/**
+ * @brief Loads eight characters as a 64-bit value, first character in the
+ * least significant byte.
+ * 
+ * @param string Input string. Must have access to at least eight characters.
+ * @return The characters, packed.
+ */
+INLINE
+u64
+_string_u64_load8
+(   const char* string
+);
+
+/**
+ * @brief Tests whether all eight characters packed in a 64-bit value are
+ * radix-10 digits (see _string_u64_load8).
+ * 
+ * @param chunk Eight packed characters.
+ * @return true if every character is in the range ['0'..'9']; false otherwise.
+ */
+INLINE
+bool
+_string_u64_digits8
+(   const u64 chunk
+);
+
+/**
+ * @brief Tests whether sixteen characters are all radix-10 digits.
+ * 
+ * Compares all sixteen characters at once using a compiler vector (SSE2 or
+ * NEON on targets which support it).
+ * 
+ * @param string Input string. Must have access to at least sixteen characters.
+ * @return true if every character is in the range ['0'..'9']; false otherwise.
+ */
+INLINE
+bool
+_string_u64_digits16
+(   const char* string
+);
+
+/**
+ * @brief Converts eight packed radix-10 digits to an integer.
+ * 
+ * Combines adjacent digits pairwise (SWAR), so only three multiplications are
+ * needed for all eight.
+ * 
+ * @param chunk Eight packed radix-10 digits (see _string_u64_digits8).
+ * @return The value of the digits (most significant first).
+ */
+INLINE
+u32
+_string_u64_parse8
+(   u64 chunk
+);
+
+/**
+ * @brief Primary implementation of to_u64_prefix and to_i64_prefix
+ * (see to_u64_prefix).
+ * 
+ * Parses the longest run of radix-10 digits at the start of the string. The
+ * first sixteen significant digits are converted at once if possible, then
+ * eight at a time while the result cannot overflow, then one at a time with
+ * exact overflow detection.
+ * 
+ * @param string Input string.
+ * @param string_length The number of characters in string.
+ * @param value Output buffer. Only written on success.
+ * @return The number of digits consumed, or 0 if there were none or the
+ * value does not fit in 64 bits.
+ */
+u64
+_string_u64_parse
+(   const char* string
+,   const u64   string_length
+,   u64*        value
+);
+
+/**
+ * @brief Writes the separator between two values of a bulk stringify
+ * operation (see string_u64_array).
+ * 
+ * @param separator The separator.
+ * @param separator_length The number of characters in separator.
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+INLINE
+u64
+_string_array_separator
+(   const char* separator
+,   const u64   separator_length
+,   char*       dst
+);
+
+/**
+ * @brief Computes the index of the end of the current field of a delimited
+ * string (see to_f64_array).
+ * 
+ * @param string Input string.
+ * @param string_length The number of characters in string.
+ * @param delimiter The character which separates fields.
+ * @return The index of the next delimiter, or string_length if there is none.
+ */
+INLINE
+u64
+_to_array_field_end
+(   const char* string
+,   const u64   string_length
+,   const char  delimiter
+);
+
 /**
  * @brief Primary implementation of string_i64 and string_u64
  * (see string_i64 and string_u64).
  * 
- * After return, the string at dst will be written in least-significant-bit
- * first order. Since the standard method for printing Arabic-numeral integers
- * is in most-significant-bit first order, the output of this function should be
- * reversed for the purpose of display.
+ * After return, the string at dst will be written in most-significant-digit
+ * first order (no terminator is appended). Radix 10 and power-of-two radices
+ * are handled by dedicated paths which compute the number of digits up front
+ * and write each digit directly into its final position.
  * 
  * @param value A 64-bit value.
  * @param radix Integer radix in the range [2..36] (inclusive).
@@ -75,6 +837,51 @@ _string_u64
 ,   char*   dst
 );
 
+/**
+ * @brief Computes the number of radix-10 digits in a 64-bit value.
+ * 
+ * @param value A 64-bit value.
+ * @return The number of digits in value (at least 1).
+ */
+INLINE
+u64
+_string_u64_radix10_length
+(   const u64 value
+);
+
+/**
+ * @brief Implementation of _string_u64 for radix 10 (see _string_u64).
+ * 
+ * Writes two digits at a time using a lookup table.
+ * 
+ * @param value A 64-bit value.
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+INLINE
+u64
+_string_u64_radix10
+(   u64     value
+,   char*   dst
+);
+
+/**
+ * @brief Implementation of _string_u64 for power-of-two radices
+ * (see _string_u64).
+ * 
+ * @param value A 64-bit value.
+ * @param shift The number of bits per digit (log2 of the radix).
+ * @param dst Output buffer for string.
+ * @return The number of characters written to dst.
+ */
+INLINE
+u64
+_string_u64_radix2n
+(   u64         value
+,   const u8    shift
+,   char*       dst
+);
+
 u64
 _string_length
 (   const char* string
@@ -187,11 +994,11 @@ string_i64
     if ( negative )
     {
         *dst = '-';
-        value = -value;
     }
 
-    u64 length = _string_u64 ( value , radix , dst + negative );
-    string_reverse ( dst + negative , length );
+    // Negate as unsigned so that the minimum value does not overflow.
+    const u64 magnitude = negative ? -( ( u64 ) value ) : ( u64 ) value;
+    u64 length = _string_u64 ( magnitude , radix , dst + negative );
     length += negative;
     dst[ length ] = 0; // Append terminator.
     return length;
@@ -218,7 +1025,6 @@ string_u64
     }
 
     const u64 length = _string_u64 ( value , radix , dst );
-    string_reverse ( dst , length );
     dst[ length ] = 0; // Append terminator.
     return length;
 }
@@ -256,7 +1062,10 @@ string_f64
         }
     }
 
-    if ( precision > STRING_FLOAT_MAX_PRECISION )
+    // Shortest round-trip representation requested? Y/N
+    const bool shortest = precision == STRING_FLOAT_SHORTEST_PRECISION;
+
+    if ( !shortest && precision > STRING_FLOAT_MAX_PRECISION )
     {
         LOGERROR ( "string_f64: Illegal value for precision argument: %u. Clamping to range [%u..%u]."
                  , precision
@@ -268,7 +1077,9 @@ string_f64
     
     // Force abbreviation if the integral part of the number is too large or too
     // small to be casted to a 64-bit signed integer.
-    if ( value <= -9223372036854775809.00 || value >= 9223372036854775808.00 )
+    if (   !shortest
+        && ( value <= -9223372036854775809.00 || value >= 9223372036854775808.00 )
+       )
     {
         abbreviated = true;
     }
@@ -284,173 +1095,276 @@ string_f64
 
     u64 length = 0;
 
-    // Abbreviated notation.
-    if ( abbreviated && value )
+    // Shortest round-trip notation.
+    if ( shortest )
     {
-        const u8 radix = 10;
-        const i64 exponent = value ? floor64 ( log64 ( abs64 ( value ) ) ) : 0;
-        const f64 mantissa = value / pow64 ( radix , exponent );
-
-        // Mantissa portion.
-        length += string_f64 ( mantissa , precision , false , dst );
-
-        // Strip the point if required precision is zero.
-        if ( !precision )
-        {
-            u64 index;
-            if ( string_contains ( dst , length
-                                 , string_char ( '.' ) , 1
-                                 , true , &index
-                                 ))
-            {
-                dst[ index ] = 0;
-                length -= 1;
-            }
-        }
-
-        // Append separator.
-        dst[ length ] = 'E';
-        length += 1;
+        length += _string_f64_shortest ( value , abbreviated , dst );
+    }
 
-        // Exponent portion.
-        length += string_i64 ( exponent , radix , dst + length );
+    // Abbreviated notation.
+    else if ( abbreviated && value )
+    {
+        length += _string_f64_abbreviated ( value , precision , dst );
     }
 
     // Standard base-10 fractional notation.
     else
     {
-        const u8 radix = 10;
-        const i64 integer = value;
-        const f64 fractional = value - integer;
-
-        // Integral portion.
-        length += string_u64 ( integer , radix , dst );
-
-        // Append point.
-        dst[ length ] = '.';
-        length += 1;
-
-        if ( precision )
-        {
-            // Fractional portion.
-            char fractional_string[ STRING_FLOAT_MAX_PRECISION ];
-            const u8 fractional_string_length = string_u64 ( ( ( fractional < 0 ) ? -fractional
-                                                                                  : fractional
-                                                             ) * pow64 ( radix , precision )
-                                                           , radix
-                                                           , fractional_string
-                                                           );
-            for ( u8 i = fractional_string_length; i < precision; ++i )
-            {
-                dst[ length ] = '0'; // Pad with leading zeroes (if needed).
-                length += 1;
-            }
-            memory_copy ( dst + length
-                        , fractional_string
-                        , fractional_string_length
-                        );
-            length += fractional_string_length;
-        }
+        length += _string_f64_fixed ( value , precision , dst );
     }
     
     dst[ length ] = 0; // Append terminator.
     return length + sign;
 }
 
-const char*
-string_bytesize
-(   u64     size
-,   f64*    amount
+u64
+string_u64_array
+(   const u64*  values
+,   const u64   count
+,   u8          radix
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
 )
 {
-    if ( size >= GiB ( 1 ) )
-    {
-        *amount = ( ( f64 ) size ) / GiB ( 1 );
-        return "GiB";
-    }
-    if ( size >= MiB ( 1 ) )
+    if ( radix < STRING_INTEGER_MIN_RADIX || radix > STRING_INTEGER_MAX_RADIX )
     {
-        *amount = ( ( f64 ) size ) / MiB ( 1 );
-        return "MiB";
+        LOGERROR ( "string_u64_array: Illegal value for radix argument: %u. Clamping to range [%u..%u].\n"
+                 , radix
+                 , STRING_INTEGER_MIN_RADIX
+                 , STRING_INTEGER_MAX_RADIX
+                 );
+        radix = CLAMP ( radix
+                      , STRING_INTEGER_MIN_RADIX
+                      , STRING_INTEGER_MAX_RADIX
+                      );
     }
-    if ( size >= KiB ( 1 ) )
+
+    char* write = dst;
+    for ( u64 i = 0; i < count; ++i )
     {
-        *amount = ( ( f64 ) size ) / KiB ( 1 );
-        return "KiB";
+        if ( i )
+        {
+            write += _string_array_separator ( separator , separator_length , write );
+        }
+        write += ( radix == 10 ) ? _string_u64_radix10 ( values[ i ] , write )
+                                 : _string_u64 ( values[ i ] , radix , write )
+                                 ;
     }
-    *amount = ( f64 ) size;
-    return "B";
+    *write = 0; // Append terminator.
+    return write - dst;
 }
 
-bool
-to_i64
-(   const char* string
-,   u64         string_length
-,   i64*        value_
+u64
+string_i64_array
+(   const i64*  values
+,   const u64   count
+,   u8          radix
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
 )
 {
-    u64 value;
-    u64 i;
-    u64 j;
+    if ( radix < STRING_INTEGER_MIN_RADIX || radix > STRING_INTEGER_MAX_RADIX )
+    {
+        LOGERROR ( "string_i64_array: Illegal value for radix argument: %u. Clamping to range [%u..%u].\n"
+                 , radix
+                 , STRING_INTEGER_MIN_RADIX
+                 , STRING_INTEGER_MAX_RADIX
+                 );
+        radix = CLAMP ( radix
+                      , STRING_INTEGER_MIN_RADIX
+                      , STRING_INTEGER_MAX_RADIX
+                      );
+    }
 
-    // Compute index of first non-whitespace character.
-    for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
+    // Only radix 10 prints a sign; other radices print the two's complement.
+    if ( radix != 10 )
+    {
+        return string_u64_array ( ( const u64* ) values
+                                , count
+                                , radix
+                                , separator
+                                , separator_length
+                                , dst
+                                );
+    }
 
-    // Whitespace-only case.
-    if ( i == string_length )
+    char* write = dst;
+    for ( u64 i = 0; i < count; ++i )
     {
-        return false;
+        if ( i )
+        {
+            write += _string_array_separator ( separator , separator_length , write );
+        }
+        const bool negative = values[ i ] < 0;
+        *write = '-';
+        write += negative;
+
+        // Negate as unsigned so that the minimum value does not overflow.
+        write += _string_u64_radix10 ( negative ? -( ( u64 ) values[ i ] ) : ( u64 ) values[ i ]
+                                     , write
+                                     );
     }
+    *write = 0; // Append terminator.
+    return write - dst;
+}
 
-    // Parse sign, if present.
-    bool negative = false;
-    if ( string[ i ] == '-' )
+u64
+string_f64_array
+(   const f64*  values
+,   const u64   count
+,   u8          precision
+,   const bool  abbreviated
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
+)
+{
+    if ( precision != STRING_FLOAT_SHORTEST_PRECISION && precision > STRING_FLOAT_MAX_PRECISION )
     {
-        negative = true;
-        i += 1;
+        LOGERROR ( "string_f64_array: Illegal value for precision argument: %u. Clamping to range [%u..%u]."
+                 , precision
+                 , 0
+                 , STRING_FLOAT_MAX_PRECISION
+                 );
+        precision = STRING_FLOAT_MAX_PRECISION;
     }
-    else if ( string[ i ] == '+' )
+
+    char* write = dst;
+    for ( u64 i = 0; i < count; ++i )
     {
-        i += 1;
+        if ( i )
+        {
+            write += _string_array_separator ( separator , separator_length , write );
+        }
+        write += string_f64 ( values[ i ] , precision , abbreviated , write );
     }
+    *write = 0; // Append terminator.
+    return write - dst;
+}
 
-    // Sign-only case.
-    if ( i == string_length )
+const char*
+string_bytesize_unit
+(   const u64   size
+,   const bool  si
+,   u64*        divisor
+)
+{
+    u32 unit;
+    if ( si )
     {
-        return false;
+        unit = ( _string_u64_radix10_length ( size ) - 1 ) / 3;
+        *divisor = string_integer_powers_of_ten[ 3 * unit ];
+    }
+    else
+    {
+        unit = size ? ( 63 - __builtin_clzll ( size ) ) / 10 : 0;
+        *divisor = 1ULL << ( 10 * unit );
     }
+    return string_bytesize_units[ si ][ unit ];
+}
 
-    // Compute index of first character which is not a leading zero.
-    for ( ; i < string_length && string[ i ] == '0'; ++i );
+const char*
+string_bytesize
+(   u64     size
+,   f64*    amount
+)
+{
+    u64 divisor;
+    const char* unit = string_bytesize_unit ( size , false , &divisor );
+    *amount = ( ( f64 ) size ) / divisor;
+    return unit;
+}
 
-    // Zero-only case.
-    if ( i == string_length )
+u64
+string_bytesize_fixed
+(   u64         size
+,   const bool  si
+,   u8          precision
+,   char*       dst
+)
+{
+    if ( precision > STRING_FLOAT_MAX_PRECISION )
     {
-        *value_ = 0;
-        return true;
+        LOGERROR ( "string_bytesize_fixed: Illegal value for precision argument: %u. Clamping to range [%u..%u]."
+                 , precision
+                 , 0
+                 , STRING_FLOAT_MAX_PRECISION
+                 );
+        precision = STRING_FLOAT_MAX_PRECISION;
     }
 
-    // Compute index of final non-whitespace character.
-    for ( j = string_length; j && whitespace ( string[ j - 1 ] ); --j );
+    u64 divisor;
+    const char* unit = string_bytesize_unit ( size , si , &divisor );
+    const u64 integer = size / divisor;
+    const u64 remainder = size - integer * divisor;
 
-    // Update length.
-    string_length = MIN ( j - i , 20U );
-    
-    // Main parsing loop.
-    value = 0;
-    for ( j = 0; j < string_length; ++j )
+    u64 length;
+
+    // CASE: Whole amount (no fractional part is written).
+    if ( !remainder )
+    {
+        length = _string_u64_radix10 ( integer , dst );
+    }
+
+    // CASE: Fractional amount; scale the remainder by 10^precision and round to
+    //       nearest, ties to even. remainder < 2^60 and 10^precision < 2^67,
+    //       so the product always fits in 128 bits.
+    else
     {
-        if ( digit ( string[ i + j ] ) )
+        const string_u128_t scale = ( precision < 20 ) ? string_integer_powers_of_ten[ precision ]
+                                                       : ( string_u128_t ) string_integer_powers_of_ten[ 19 ] * 10
+                                                       ;
+        const string_u128_t product = remainder * scale;
+        string_u128_t fraction = product / divisor;
+        const u64 excess = product - fraction * divisor;
+        const bool odd = ( precision ? ( u64 ) fraction : integer ) & 1;
+        fraction += excess > divisor - excess || ( excess == divisor - excess && odd );
+
+        // Carry into the integral part (i.e. 1023.999 KiB -> 1024.00 KiB).
+        if ( fraction == scale )
         {
-            value = 10 * value + to_digit ( string[ i + j ] );
+            length = _string_fixed_point ( integer + 1 , 0 , precision , dst );
         }
         else
         {
-            return false;
+            length = _string_fixed_point ( integer , fraction , precision , dst );
         }
     }
 
-    *value_ = negative ? -value : value;
+    // Append unit.
+    dst[ length ] = ' ';
+    length += 1;
+    const u64 unit_length = _string_length ( unit );
+    memory_copy ( dst + length , unit , unit_length );
+    length += unit_length;
+    dst[ length ] = 0; // Append terminator.
+    return length;
+}
+
+bool
+to_i64
+(   const char* string
+,   u64         string_length
+,   i64*        value_
+)
+{
+    i64 value;
+    u64 i = to_i64_prefix ( string , string_length , &value );
+    if ( !i )
+    {
+        return false;
+    }
+
+    // Only whitespace may follow the value.
+    for ( ; i < string_length && whitespace ( string[ i ] ); ++i );
+    if ( i != string_length )
+    {
+        return false;
+    }
+
+    *value_ = value;
     return true;
 }
 
@@ -462,50 +1376,74 @@ to_u64
 )
 {
     u64 value;
+    u64 i = to_u64_prefix ( string , string_length , &value );
+    if ( !i )
+    {
+        return false;
+    }
+
+    // Only whitespace may follow the value.
+    for ( ; i < string_length && whitespace ( string[ i ] ); ++i );
+    if ( i != string_length )
+    {
+        return false;
+    }
+
+    *value_ = value;
+    return true;
+}
+
+u64
+to_i64_prefix
+(   const char* string
+,   u64         string_length
+,   i64*        value_
+)
+{
     u64 i;
-    u64 j;
 
     // Compute index of first non-whitespace character.
     for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
 
-    // Whitespace-only case.
-    if ( i == string_length )
+    // Parse sign, if present.
+    bool negative = false;
+    if ( i < string_length && ( string[ i ] == '-' || string[ i ] == '+' ) )
     {
-        return false;
+        negative = string[ i ] == '-';
+        i += 1;
     }
 
-    // Compute index of first character which is not a leading zero.
-    for ( ; i < string_length && string[ i ] == '0'; ++i );
-
-    // Zero-only case.
-    if ( i == string_length )
+    u64 value;
+    const u64 length = _string_u64_parse ( string + i , string_length - i , &value );
+    if ( !length )
     {
-        *value_ = 0;
-        return true;
+        return 0;
     }
 
-    // Compute index of final non-whitespace character.
-    for ( j = string_length; j && whitespace ( string[ j - 1 ] ); --j );
-
-    // Update length.
-    string_length = MIN ( j - i , 20U );
-    
-    // Main parsing loop.
-    value = 0;
-    for ( j = 0; j < string_length; ++j )
+    // Magnitude must fit in a signed 64-bit integer.
+    if ( value > ( 1ULL << 63 ) - !negative )
     {
-        if ( digit ( string[ i + j ] ) )
-        {
-            value = 10 * value + to_digit ( string[ i + j ] );
-        }
-        else
-        {
-            return false;
-        }
+        return 0;
     }
 
-    *value_ = value;
-    return true;
+    *value_ = negative ? -value : value;
+    return i + length;
+}
+
+u64
+to_u64_prefix
+(   const char* string
+,   u64         string_length
+,   u64*        value_
+)
+{
+    u64 i;
+
+    // Compute index of first non-whitespace character.
+    for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
+
+    const u64 length = _string_u64_parse ( string + i , string_length - i , value_ );
+    return length ? i + length : 0;
 }
 
 bool
@@ -558,7 +1496,7 @@ to_f64
     for ( j = string_length; j && whitespace ( string[ j - 1 ] ); --j );
 
     // Update length.
-    string_length = MIN ( j - i , 64U );
+    string_length = j - i;
 
     // Infinity / NaN ? Y/N
     if (   string_length == nan_length
@@ -590,81 +1528,300 @@ to_f64
         }
     }
 
-    // Compute index of first character which is not a leading zero.
-    for ( ; i < j && string[ i ] == '0'; ++i );
-
-    // Zero-only case.
-    if ( ( i == j ) || ( ( i == j - 1 ) && string[ i ] == '.' ) )
+    // Parse mantissa. Up to STRING_F64_PARSE_MAX_DIGITS significant digits are
+    // accumulated exactly; any further digits only adjust the exponent.
+    const u64 mantissa_start = i;
+    u64 mantissa = 0;
+    i64 exponent = 0;
+    u32 digit_count = 0;
+    bool digits = false;
+    bool point = false;
+    bool truncated = false;
+    for ( ; i < j; ++i )
     {
-        *value_ = 0;
-        return true;
+        if ( digit ( string[ i ] ) )
+        {
+            const u8 digit_value = to_digit ( string[ i ] );
+            digits = true;
+            if ( !mantissa && !digit_value )
+            {
+                exponent -= point; // Leading zero.
+            }
+            else if ( digit_count < STRING_F64_PARSE_MAX_DIGITS )
+            {
+                mantissa = 10 * mantissa + digit_value;
+                digit_count += 1;
+                exponent -= point;
+            }
+            else
+            {
+                truncated |= digit_value != 0;
+                exponent += !point;
+            }
+        }
+        else if ( string[ i ] == '.' && !point )
+        {
+            point = true;
+        }
+        else
+        {
+            break;
+        }
     }
+    const u64 mantissa_length = i - mantissa_start;
 
-    // Remove trailing zeroes after decimal point, if present.
-    u64 point_index = string_length;
-    if ( string_contains ( string + i , string_length
-                         , string_char ( '.' ) , 1
-                         , false
-                         , &point_index
-                         ))
+    // Parse exponent, if present.
+    i64 explicit_exponent = 0;
+    if ( i < j && ( string[ i ] == 'e' || string[ i ] == 'E' ) )
     {
-        for ( ; string[ i + j - 1 ] == '0'; --j );
-        string_length = MIN ( j - i , 64U );
-    }
+        if ( !digits )
+        {
+            return false;
+        }
+        i += 1;
 
-    // CASE: Too large, should be in abbreviated notation.
-    // TODO: Handle this properly.
-    const u64 integral_length = point_index;
-    if ( integral_length > 19 )
-    {
-        return false;
-    }
-    
-    // Parse integral portion.
-    value = 0.0;
-    for ( j = 0; j < integral_length; ++j )
-    {
-        if ( digit ( string[ i + j ] ) )
+        bool exponent_negative = false;
+        if ( i < j && ( string[ i ] == '-' || string[ i ] == '+' ) )
         {
-            value = 10 * value + to_digit ( string[ i + j ] );
+            exponent_negative = string[ i ] == '-';
+            i += 1;
         }
-        else
+        if ( i == j )
         {
             return false;
         }
-    }
-    
-    // Parse fractional portion.
-    f64 fractional = 0.0;
-    for ( j += 1; j < string_length; ++j )
-    {
-        if ( digit ( string[ i + j ] ) )
+        for ( ; i < j && digit ( string[ i ] ); ++i )
         {
-            const u64 base = 10;
-            f64 scale = 1.0;
-            for ( u64 exponent = integral_length; exponent < j; ++exponent )
+            // Saturate; any larger magnitude is already out of range.
+            if ( explicit_exponent < 100000 )
             {
-                scale /= base;
+                explicit_exponent = 10 * explicit_exponent + to_digit ( string[ i ] );
             }
-            fractional += scale * to_digit ( string[ i + j ] );
         }
-        else
+        if ( exponent_negative )
         {
-            return false;
+            explicit_exponent = -explicit_exponent;
         }
+        exponent += explicit_exponent;
     }
-    value += fractional;
 
-    // Apply sign, if needed.
-    if ( negative )
+    // Trailing garbage fails.
+    if ( i != j )
     {
-        value = -value;
+        return false;
+    }
+
+    // Zero-only case.
+    if ( !mantissa )
+    {
+        *value_ = 0;
+        return true;
+    }
+
+    // CASE: Mantissa and power of ten are both exact, so a single operation
+    //       rounds correctly.
+    if (   !truncated
+        && mantissa <= ( 1ULL << ( STRING_F64_MANTISSA_BITS + 1 ) )
+        && exponent >= -STRING_F64_PARSE_EXACT_EXPONENT
+        && exponent <= STRING_F64_PARSE_EXACT_EXPONENT
+       )
+    {
+        value = ( exponent < 0 ) ? ( f64 ) mantissa / string_f64_exact_powers_of_ten[ -exponent ]
+                                 : ( f64 ) mantissa * string_f64_exact_powers_of_ten[ exponent ]
+                                 ;
+    }
+
+    // CASE: Underflow.
+    else if ( exponent < STRING_F64_PARSE_MIN_EXPONENT )
+    {
+        value = 0;
+    }
+
+    // CASE: Overflow.
+    else if ( exponent > STRING_F64_PARSE_MAX_EXPONENT )
+    {
+        value = INFINITY_64;
+    }
+
+    else
+    {
+        union
+        {
+            f64 f;
+            u64 u;
+        }
+        bits;
+
+        // If digits were dropped, the value lies between mantissa and
+        // mantissa + 1; both must round to the same result.
+        u64 upper;
+        if ( !_string_f64_eisel_lemire ( mantissa , exponent , &bits.u )
+            || (   truncated
+                && (   !_string_f64_eisel_lemire ( mantissa + 1 , exponent , &upper )
+                    || upper != bits.u
+                   )
+               )
+           )
+        {
+            string_f64_big_decimal_t decimal;
+            _string_f64_big_decimal ( string + mantissa_start
+                                    , mantissa_length
+                                    , explicit_exponent
+                                    , &decimal
+                                    );
+            bits.u = _string_f64_big_decimal_bits ( &decimal );
+        }
+        value = bits.f;
+    }
+
+    // Apply sign, if needed.
+    if ( negative )
+    {
+        value = -value;
     }
 
     *value_ = value;
     return true;
 }
 
+bool
+to_u64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   u64*        dst
+,   const u64   capacity
+,   u64*        count
+)
+{
+    u64 i;
+    u64 n = 0;
+
+    // Whitespace-only case.
+    for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
+    if ( i == string_length )
+    {
+        *count = 0;
+        return true;
+    }
+
+    for ( i = 0; ; ++i )
+    {
+        u64 length;
+        if ( n == capacity || !( length = to_u64_prefix ( string + i , string_length - i , dst + n ) ) )
+        {
+            *count = n;
+            return false;
+        }
+        n += 1;
+
+        // Skip trailing whitespace, then expect a delimiter or the end.
+        for ( i += length; i < string_length && string[ i ] != delimiter && whitespace ( string[ i ] ); ++i );
+        if ( i == string_length )
+        {
+            break;
+        }
+        if ( string[ i ] != delimiter )
+        {
+            *count = n - 1;
+            return false;
+        }
+    }
+
+    *count = n;
+    return true;
+}
+
+bool
+to_i64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   i64*        dst
+,   const u64   capacity
+,   u64*        count
+)
+{
+    u64 i;
+    u64 n = 0;
+
+    // Whitespace-only case.
+    for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
+    if ( i == string_length )
+    {
+        *count = 0;
+        return true;
+    }
+
+    for ( i = 0; ; ++i )
+    {
+        u64 length;
+        if ( n == capacity || !( length = to_i64_prefix ( string + i , string_length - i , dst + n ) ) )
+        {
+            *count = n;
+            return false;
+        }
+        n += 1;
+
+        // Skip trailing whitespace, then expect a delimiter or the end.
+        for ( i += length; i < string_length && string[ i ] != delimiter && whitespace ( string[ i ] ); ++i );
+        if ( i == string_length )
+        {
+            break;
+        }
+        if ( string[ i ] != delimiter )
+        {
+            *count = n - 1;
+            return false;
+        }
+    }
+
+    *count = n;
+    return true;
+}
+
+bool
+to_f64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   f64*        dst
+,   const u64   capacity
+,   u64*        count
+)
+{
+    u64 i;
+    u64 n = 0;
+
+    // Whitespace-only case.
+    for ( i = 0; i < string_length && whitespace ( string[ i ] ); ++i );
+    if ( i == string_length )
+    {
+        *count = 0;
+        return true;
+    }
+
+    for ( i = 0; ; ++i )
+    {
+        const u64 length = _to_array_field_end ( string + i , string_length - i , delimiter );
+        if ( n == capacity || !to_f64 ( string + i , length , dst + n ) )
+        {
+            *count = n;
+            return false;
+        }
+        n += 1;
+
+        i += length;
+        if ( i == string_length )
+        {
+            break;
+        }
+    }
+
+    *count = n;
+    return true;
+}
+
 char*
 string_trim
 (   const char* src
@@ -851,18 +2008,139 @@ __string_contains
         }
         return true;
     }
-    for ( u64 i = 0; i <= search_length - find_length; ++i )
+    u64 index_;
+    bool found;
+    if ( find_length == 1 )
+    {
+        found = _string_contains_character ( search , search_length , *find , false , &index_ );
+    }
+    else if ( find_length < STRING_CONTAINS_HORSPOOL_MIN_LENGTH )
+    {
+        found = _string_contains_filter ( search , search_length , find , find_length , false , &index_ );
+    }
+    else
+    {
+        found = _string_contains_horspool ( search , search_length , find , find_length , false , &index_ );
+    }
+    if ( found && index )
+    {
+        *index = index_;
+    }
+    return found;
+}
+
+bool
+__string_contains_reverse
+(   const char* search
+,   const u64   search_length
+,   const char* find
+,   const u64   find_length
+,   u64*        index
+)
+{
+    if ( !find_length )
+    {
+        if ( index )
+        {
+            *index = search_length - 1;
+        }
+        return true;
+    }
+    u64 index_;
+    bool found;
+    if ( find_length == 1 )
+    {
+        found = _string_contains_character ( search , search_length , *find , true , &index_ );
+    }
+    else if ( find_length < STRING_CONTAINS_HORSPOOL_MIN_LENGTH )
+    {
+        found = _string_contains_filter ( search , search_length , find , find_length , true , &index_ );
+    }
+    else
+    {
+        found = _string_contains_horspool ( search , search_length , find , find_length , true , &index_ );
+    }
+    if ( found && index )
+    {
+        *index = index_;
+    }
+    return found;
+}
+
+INLINE
+void
+_string_contains_mask
+(   const string_contains_vector_t  block
+,   u64                             mask[ 2 ]
+)
+{
+    __builtin_memcpy ( mask , &block , 2 * sizeof ( u64 ) );
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    mask[ 0 ] = __builtin_bswap64 ( mask[ 0 ] );
+    mask[ 1 ] = __builtin_bswap64 ( mask[ 1 ] );
+#endif
+    mask[ 0 ] &= 0x8080808080808080ULL;
+    mask[ 1 ] &= 0x8080808080808080ULL;
+}
+
+bool
+_string_contains_character
+(   const char* search
+,   const u64   search_length
+,   const char  find
+,   const bool  reverse
+,   u64*        index
+)
+{
+    const string_contains_vector_t pattern = ( string_contains_vector_t ){ 0 } + ( u8 ) find;
+    string_contains_vector_t block;
+    u64 mask[ 2 ];
+
+    // CASE: Search begins from the end of the string.
+    if ( reverse )
     {
-        if ( search[ i ] != *find )
+        u64 end = search_length;
+        for ( ; end >= sizeof ( string_contains_vector_t ); end -= sizeof ( string_contains_vector_t ) )
         {
-            continue;
+            const u64 i = end - sizeof ( string_contains_vector_t );
+            __builtin_memcpy ( &block , search + i , sizeof ( block ) );
+            _string_contains_mask ( ( string_contains_vector_t )( block == pattern ) , mask );
+            if ( mask[ 0 ] | mask[ 1 ] )
+            {
+                *index = ( mask[ 1 ] ) ? i + 8 + ( ( 63 - __builtin_clzll ( mask[ 1 ] ) ) >> 3 )
+                                       : i + ( ( 63 - __builtin_clzll ( mask[ 0 ] ) ) >> 3 );
+                return true;
+            }
         }
-        if ( memory_equal ( search + i + 1 , find + 1 , find_length - 1 ) )
+        for ( ; end; --end )
         {
-            if ( index )
+            if ( search[ end - 1 ] == find )
             {
-                *index = i;
+                *index = end - 1;
+                return true;
             }
+        }
+        return false;
+    }
+
+    // CASE: Search begins from the start of the string.
+    u64 i = 0;
+    for ( ; i + sizeof ( string_contains_vector_t ) <= search_length; i += sizeof ( string_contains_vector_t ) )
+    {
+        __builtin_memcpy ( &block , search + i , sizeof ( block ) );
+        _string_contains_mask ( ( string_contains_vector_t )( block == pattern ) , mask );
+        if ( mask[ 0 ] | mask[ 1 ] )
+        {
+            *index = ( mask[ 0 ] ) ? i + ( __builtin_ctzll ( mask[ 0 ] ) >> 3 )
+                                   : i + 8 + ( __builtin_ctzll ( mask[ 1 ] ) >> 3 );
+            return true;
+        }
+    }
+    for ( ; i < search_length; ++i )
+    {
+        if ( search[ i ] == find )
+        {
+            *index = i;
             return true;
         }
     }
@@ -870,36 +2148,188 @@ __string_contains
 }
 
 bool
-__string_contains_reverse
+_string_contains_filter
 (   const char* search
 ,   const u64   search_length
 ,   const char* find
 ,   const u64   find_length
+,   const bool  reverse
 ,   u64*        index
 )
 {
-    if ( !find_length )
+    const string_contains_vector_t first = ( string_contains_vector_t ){ 0 } + ( u8 )( find[ 0 ] );
+    const string_contains_vector_t last = ( string_contains_vector_t ){ 0 } + ( u8 )( find[ find_length - 1 ] );
+    const u64 start_count = search_length - find_length + 1; // Number of positions find may start at.
+    string_contains_vector_t block_first;
+    string_contains_vector_t block_last;
+    u64 mask[ 2 ];
+
+    // CASE: Search begins from the end of the string.
+    if ( reverse )
     {
-        if ( index )
+        u64 end = start_count;
+        for ( ; end >= sizeof ( string_contains_vector_t ); end -= sizeof ( string_contains_vector_t ) )
         {
-            *index = search_length - 1;
+            const u64 i = end - sizeof ( string_contains_vector_t );
+            __builtin_memcpy ( &block_first , search + i , sizeof ( block_first ) );
+            __builtin_memcpy ( &block_last , search + i + find_length - 1 , sizeof ( block_last ) );
+            _string_contains_mask ( ( string_contains_vector_t )( ( block_first == first ) & ( block_last == last ) )
+                                  , mask
+                                  );
+            for ( u64 j = 2; j; --j )
+            {
+                while ( mask[ j - 1 ] )
+                {
+                    const u64 bit = 63 - __builtin_clzll ( mask[ j - 1 ] );
+                    const u64 candidate = i + 8 * ( j - 1 ) + ( bit >> 3 );
+                    if ( memory_equal ( search + candidate + 1 , find + 1 , find_length - 2 ) )
+                    {
+                        *index = candidate;
+                        return true;
+                    }
+                    mask[ j - 1 ] ^= 1ULL << bit;
+                }
+            }
+        }
+        for ( ; end; --end )
+        {
+            if (   search[ end - 1 ] == find[ 0 ]
+                && search[ end - 1 + find_length - 1 ] == find[ find_length - 1 ]
+                && memory_equal ( search + end , find + 1 , find_length - 2 )
+               )
+            {
+                *index = end - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // CASE: Search begins from the start of the string.
+    u64 i = 0;
+    for ( ; i + sizeof ( string_contains_vector_t ) <= start_count; i += sizeof ( string_contains_vector_t ) )
+    {
+        __builtin_memcpy ( &block_first , search + i , sizeof ( block_first ) );
+        __builtin_memcpy ( &block_last , search + i + find_length - 1 , sizeof ( block_last ) );
+        _string_contains_mask ( ( string_contains_vector_t )( ( block_first == first ) & ( block_last == last ) )
+                              , mask
+                              );
+        for ( u64 j = 0; j < 2; ++j )
+        {
+            while ( mask[ j ] )
+            {
+                const u64 candidate = i + 8 * j + ( __builtin_ctzll ( mask[ j ] ) >> 3 );
+                if ( memory_equal ( search + candidate + 1 , find + 1 , find_length - 2 ) )
+                {
+                    *index = candidate;
+                    return true;
+                }
+                mask[ j ] &= mask[ j ] - 1;
+            }
         }
-        return true;
     }
-    for ( u64 i = search_length - find_length + 1; i; --i )
+    for ( ; i < start_count; ++i )
     {
-        if ( search[ i - 1 ] != *find )
+        if (   search[ i ] == find[ 0 ]
+            && search[ i + find_length - 1 ] == find[ find_length - 1 ]
+            && memory_equal ( search + i + 1 , find + 1 , find_length - 2 )
+           )
         {
-            continue;
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+_string_contains_horspool
+(   const char* search
+,   const u64   search_length
+,   const char* find
+,   const u64   find_length
+,   const bool  reverse
+,   u64*        index
+)
+{
+    // Build the bad-character table: how far the window may move when the
+    // character at its leading edge is c, without skipping past a match.
+    u64 shift[ 256 ];
+    for ( u64 c = 0; c < 256; ++c )
+    {
+        shift[ c ] = find_length;
+    }
+
+    // CASE: Search begins from the end of the string (window moves left; its
+    //       leading edge is its first character).
+    if ( reverse )
+    {
+        for ( u64 i = find_length - 1; i; --i )
+        {
+            shift[ ( u8 )( find[ i ] ) ] = i;
         }
-        if ( memory_equal ( search + i , find + 1 , find_length - 1 ) )
+        u64 i = search_length - find_length;
+        u64 checkpoint = i;
+        for ( u64 step = 1; ; ++step )
         {
-            if ( index )
+            const u8 c = search[ i ];
+            if (   c == ( u8 )( find[ 0 ] )
+                && memory_equal ( search + i + 1 , find + 1 , find_length - 1 )
+               )
+            {
+                *index = i;
+                return true;
+            }
+            if ( shift[ c ] > i )
+            {
+                return false;
+            }
+            i -= shift[ c ];
+            if ( !( step % STRING_CONTAINS_HORSPOOL_PROBE_STEPS ) )
             {
-                *index = i - 1;
+                if ( checkpoint - i < STRING_CONTAINS_HORSPOOL_PROBE_STEPS * sizeof ( string_contains_vector_t ) )
+                {
+                    return _string_contains_filter ( search , i + find_length , find , find_length , true , index );
+                }
+                checkpoint = i;
             }
+        }
+    }
+
+    // CASE: Search begins from the start of the string (window moves right;
+    //       its leading edge is its last character).
+    for ( u64 i = 0; i < find_length - 1; ++i )
+    {
+        shift[ ( u8 )( find[ i ] ) ] = find_length - 1 - i;
+    }
+    const u8 last = find[ find_length - 1 ];
+    u64 checkpoint = 0;
+    for ( u64 i = 0 , step = 1; i <= search_length - find_length; ++step )
+    {
+        const u8 c = search[ i + find_length - 1 ];
+        if (   c == last
+            && memory_equal ( search + i , find , find_length - 1 )
+           )
+        {
+            *index = i;
             return true;
         }
+        i += shift[ c ];
+        if ( !( step % STRING_CONTAINS_HORSPOOL_PROBE_STEPS ) )
+        {
+            if ( i - checkpoint < STRING_CONTAINS_HORSPOOL_PROBE_STEPS * sizeof ( string_contains_vector_t ) )
+            {
+                if (   i > search_length - find_length
+                    || !_string_contains_filter ( search + i , search_length - i , find , find_length , false , index )
+                   )
+                {
+                    return false;
+                }
+                *index += i;
+                return true;
+            }
+            checkpoint = i;
+        }
     }
     return false;
 }
@@ -911,21 +2341,1151 @@ _string_u64
 ,   char*   dst
 )
 {
-    char* i = dst;
+    if ( radix == 10 )
+    {
+        return _string_u64_radix10 ( value , dst );
+    }
+
+    // CASE: Power-of-two radix.
+    if ( !( radix & ( radix - 1 ) ) )
+    {
+        return _string_u64_radix2n ( value , __builtin_ctz ( radix ) , dst );
+    }
+
+    // Any other radix: write least-significant digit first into a local
+    // buffer, then copy the digits to dst in order.
+    char buffer[ STRING_INTEGER_MAX_LENGTH ];
+    char* i = buffer + sizeof ( buffer );
     do
     {
-        const u8 digit = value % radix;
+        i -= 1;
+        *i = string_integer_digits[ value % radix ];
         value /= radix;
-        if ( digit < 10 )
-        {
-            *i = '0' + digit;
-        }
-        else
-        {
-            *i = 'A' + digit - 10;
-        }
-        i += 1;
     }
     while ( value );
-    return i - dst;
-}
\ No newline at end of file
+    const u64 length = ( buffer + sizeof ( buffer ) ) - i;
+    memory_copy ( dst , i , length );
+    return length;
+}
+
+INLINE
+u64
+_string_u64_radix10_length
+(   const u64 value
+)
+{
+    // log10 ( value ) ~= log2 ( value ) * 1233 / 4096. Setting the low bit
+    // handles value == 0 and never changes the digit count.
+    const u64 x = value | 1;
+    const u64 bits = 64 - __builtin_clzll ( x );
+    const u64 estimate = ( bits * 1233 ) >> 12;
+    return estimate + 1 - ( x < string_integer_powers_of_ten[ estimate ] );
+}
+
+INLINE
+u64
+_string_u64_radix10
+(   u64     value
+,   char*   dst
+)
+{
+    // CASE: Single digit.
+    if ( value < 10 )
+    {
+        *dst = '0' + value;
+        return 1;
+    }
+
+    const u64 length = _string_u64_radix10_length ( value );
+    char* i = dst + length;
+    while ( value >= 100 )
+    {
+        const u64 pair = 2 * ( value % 100 );
+        value /= 100;
+        i -= 2;
+        i[ 0 ] = string_integer_digit_pairs[ pair ];
+        i[ 1 ] = string_integer_digit_pairs[ pair + 1 ];
+    }
+    if ( value >= 10 )
+    {
+        i[ -2 ] = string_integer_digit_pairs[ 2 * value ];
+        i[ -1 ] = string_integer_digit_pairs[ 2 * value + 1 ];
+    }
+    else
+    {
+        i[ -1 ] = '0' + value;
+    }
+    return length;
+}
+
+INLINE
+u64
+_string_u64_radix2n
+(   u64         value
+,   const u8    shift
+,   char*       dst
+)
+{
+    const u64 mask = ( 1ULL << shift ) - 1;
+    const u64 bits = 64 - __builtin_clzll ( value | 1 );
+    const u64 length = ( bits + shift - 1 ) / shift;
+    char* i = dst + length;
+    do
+    {
+        i -= 1;
+        *i = string_integer_digits[ value & mask ];
+        value >>= shift;
+    }
+    while ( i != dst );
+    return length;
+}
+
+INLINE
+u32
+_string_f64_pow5_bits
+(   const u32 e
+)
+{
+    return ( ( e * 1217359 ) >> 19 ) + 1;
+}
+
+INLINE
+string_u128_t
+_string_f64_pow5
+(   const u32 i
+)
+{
+    const u32 base = i / STRING_F64_POW5_TABLE_STRIDE;
+    const u32 offset = i - base * STRING_F64_POW5_TABLE_STRIDE;
+    const string_u128_t multiplier = ( ( string_u128_t )( string_f64_pow5_split[ base ][ 1 ] ) << 64 )
+                                   | string_f64_pow5_split[ base ][ 0 ]
+                                   ;
+    if ( !offset )
+    {
+        return multiplier;
+    }
+
+    // Multiply by the remaining power of five (192-bit product) and shift it
+    // back down to 125 bits.
+    const u64 m = string_f64_pow5[ offset ];
+    const string_u128_t low = ( string_u128_t ) m * ( u64 ) multiplier;
+    const string_u128_t high = ( string_u128_t ) m * ( u64 )( multiplier >> 64 )
+                             + ( low >> 64 )
+                             ;
+    const u32 delta = _string_f64_pow5_bits ( i )
+                    - _string_f64_pow5_bits ( base * STRING_F64_POW5_TABLE_STRIDE )
+                    ;
+    const u32 correction = ( string_f64_pow5_offsets[ i / 16 ] >> ( ( i % 16 ) << 1 ) ) & 3;
+    return ( ( high << ( 64 - delta ) ) | ( ( u64 ) low >> delta ) ) + correction;
+}
+
+INLINE
+string_u128_t
+_string_f64_pow5_inv
+(   const u32 i
+)
+{
+    const u32 base = ( i + STRING_F64_POW5_TABLE_STRIDE - 1 ) / STRING_F64_POW5_TABLE_STRIDE;
+    const u32 offset = base * STRING_F64_POW5_TABLE_STRIDE - i;
+    const string_u128_t multiplier = ( ( string_u128_t )( string_f64_pow5_inv_split[ base ][ 1 ] ) << 64 )
+                                   | string_f64_pow5_inv_split[ base ][ 0 ]
+                                   ;
+    if ( !offset )
+    {
+        return multiplier;
+    }
+
+    // Multiply by the remaining power of five (192-bit product) and shift it
+    // back down to 125 bits. The stored inverse is rounded up, so subtract one
+    // to keep the product a lower bound.
+    const u64 m = string_f64_pow5[ offset ];
+    const string_u128_t low = ( string_u128_t ) m * ( u64 )( multiplier - 1 );
+    const string_u128_t high = ( string_u128_t ) m * ( u64 )( ( multiplier - 1 ) >> 64 )
+                             + ( low >> 64 )
+                             ;
+    const u32 delta = _string_f64_pow5_bits ( base * STRING_F64_POW5_TABLE_STRIDE )
+                    - _string_f64_pow5_bits ( i )
+                    ;
+    const u32 correction = ( string_f64_pow5_inv_offsets[ i / 16 ] >> ( ( i % 16 ) << 1 ) ) & 3;
+    return ( ( high << ( 64 - delta ) ) | ( ( u64 ) low >> delta ) ) + correction;
+}
+
+INLINE
+u64
+_string_f64_mul_shift
+(   const u64           m
+,   const string_u128_t multiplier
+,   const u32           j
+)
+{
+    const string_u128_t low = ( string_u128_t ) m * ( u64 ) multiplier;
+    const string_u128_t high = ( string_u128_t ) m * ( u64 )( multiplier >> 64 );
+    return ( ( low >> 64 ) + high ) >> ( j - 64 );
+}
+
+INLINE
+u32
+_string_f64_pow5_factor
+(   u64 value
+)
+{
+    u32 count = 0;
+    while ( !( value % 5 ) )
+    {
+        value /= 5;
+        count += 1;
+    }
+    return count;
+}
+
+string_f64_decimal_t
+_string_f64_decimal
+(   const f64 value
+)
+{
+    union
+    {
+        f64 f;
+        u64 u;
+    }
+    bits = { .f = value };
+    const u64 ieee_mantissa = bits.u & ( ( 1ULL << STRING_F64_MANTISSA_BITS ) - 1 );
+    const u32 ieee_exponent = ( bits.u >> STRING_F64_MANTISSA_BITS )
+                            & ( ( 1U << STRING_F64_EXPONENT_BITS ) - 1 )
+                            ;
+
+    // Decode the value as m2 * 2^e2. Two extra bits of exponent make room for
+    // the interval bounds below.
+    i32 e2;
+    u64 m2;
+    if ( !ieee_exponent )
+    {
+        e2 = 1 - STRING_F64_EXPONENT_BIAS - STRING_F64_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = ( i32 ) ieee_exponent - STRING_F64_EXPONENT_BIAS - STRING_F64_MANTISSA_BITS - 2;
+        m2 = ( 1ULL << STRING_F64_MANTISSA_BITS ) | ieee_mantissa;
+    }
+    const bool accept_bounds = !( m2 & 1 );
+
+    // Rounding interval: [mm, mp] around mv (all scaled by 4). The lower gap is
+    // half as wide when the value sits on a power-of-two boundary.
+    const u64 mv = 4 * m2;
+    const u32 mm_shift = ieee_mantissa || ieee_exponent <= 1;
+
+    // Scale the interval by a power of ten.
+    u64 vr;
+    u64 vp;
+    u64 vm;
+    i32 e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+    if ( e2 >= 0 )
+    {
+        const u32 q = ( ( ( u32 ) e2 * 78913 ) >> 18 ) - ( e2 > 3 );
+        const u32 j = STRING_F64_POW5_BITS + _string_f64_pow5_bits ( q ) - 1 - e2 + q;
+        const string_u128_t multiplier = _string_f64_pow5_inv ( q );
+        e10 = q;
+        vr = _string_f64_mul_shift ( 4 * m2 , multiplier , j );
+        vp = _string_f64_mul_shift ( 4 * m2 + 2 , multiplier , j );
+        vm = _string_f64_mul_shift ( 4 * m2 - 1 - mm_shift , multiplier , j );
+        if ( q <= 21 )
+        {
+            // At most one of mp, mv, and mm is a multiple of 5.
+            if ( !( mv % 5 ) )
+            {
+                vr_trailing_zeros = _string_f64_pow5_factor ( mv ) >= q;
+            }
+            else if ( accept_bounds )
+            {
+                vm_trailing_zeros = _string_f64_pow5_factor ( mv - 1 - mm_shift ) >= q;
+            }
+            else
+            {
+                vp -= _string_f64_pow5_factor ( mv + 2 ) >= q;
+            }
+        }
+    }
+    else
+    {
+        const u32 q = ( ( ( u32 )( -e2 ) * 732923 ) >> 20 ) - ( -e2 > 1 );
+        const u32 i = -e2 - q;
+        const u32 j = q + STRING_F64_POW5_BITS - _string_f64_pow5_bits ( i );
+        const string_u128_t multiplier = _string_f64_pow5 ( i );
+        e10 = ( i32 ) q + e2;
+        vr = _string_f64_mul_shift ( 4 * m2 , multiplier , j );
+        vp = _string_f64_mul_shift ( 4 * m2 + 2 , multiplier , j );
+        vm = _string_f64_mul_shift ( 4 * m2 - 1 - mm_shift , multiplier , j );
+        if ( q <= 1 )
+        {
+            // mv = 4 * m2, so it has at least two trailing zero bits.
+            vr_trailing_zeros = true;
+            if ( accept_bounds )
+            {
+                vm_trailing_zeros = mm_shift == 1;
+            }
+            else
+            {
+                vp -= 1;
+            }
+        }
+        else if ( q < 63 )
+        {
+            vr_trailing_zeros = !( mv & ( ( 1ULL << q ) - 1 ) );
+        }
+    }
+
+    // Remove digits while the interval still contains a unique decimal.
+    i32 removed = 0;
+    u64 output;
+    if ( vm_trailing_zeros || vr_trailing_zeros )
+    {
+        // CASE: General (rare).
+        u8 last_removed_digit = 0;
+        while ( vp / 10 > vm / 10 )
+        {
+            vm_trailing_zeros &= !( vm % 10 );
+            vr_trailing_zeros &= !last_removed_digit;
+            last_removed_digit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        if ( vm_trailing_zeros )
+        {
+            while ( !( vm % 10 ) )
+            {
+                vr_trailing_zeros &= !last_removed_digit;
+                last_removed_digit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed += 1;
+            }
+        }
+        
+        // Round to even if the exact value ends in 5.
+        if ( vr_trailing_zeros && last_removed_digit == 5 && !( vr % 2 ) )
+        {
+            last_removed_digit = 4;
+        }
+        output = vr + ( ( vr == vm && ( !accept_bounds || !vm_trailing_zeros ) )
+                     || last_removed_digit >= 5
+                      );
+    }
+    else
+    {
+        // CASE: Common.
+        bool round_up = false;
+        if ( vp / 100 > vm / 100 )
+        {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while ( vp / 10 > vm / 10 )
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        output = vr + ( vr == vm || round_up );
+    }
+
+    string_f64_decimal_t decimal;
+    decimal.mantissa = output;
+    decimal.exponent = e10 + removed;
+    return decimal;
+}
+
+u64
+_string_f64_shortest
+(   const f64   value
+,   bool        abbreviated
+,   char*       dst
+)
+{
+    // CASE: Zero.
+    if ( !value )
+    {
+        memory_copy ( dst , "0.0" , 3 );
+        return 3;
+    }
+
+    const string_f64_decimal_t decimal = _string_f64_decimal ( value );
+    char digits[ STRING_INTEGER_MAX_LENGTH ];
+    u64 digit_count = _string_u64_radix10 ( decimal.mantissa , digits );
+    i32 exponent = decimal.exponent;
+    while ( digit_count > 1 && digits[ digit_count - 1 ] == '0' )
+    {
+        digit_count -= 1;
+        exponent += 1;
+    }
+
+    // Position of the decimal point relative to the first digit.
+    const i32 point = exponent + ( i32 ) digit_count;
+    if ( point < STRING_F64_SHORTEST_MIN_POINT || point > STRING_F64_SHORTEST_MAX_POINT )
+    {
+        abbreviated = true;
+    }
+
+    u64 length = 0;
+
+    // Abbreviated notation.
+    if ( abbreviated )
+    {
+        dst[ length ] = digits[ 0 ];
+        length += 1;
+        if ( digit_count > 1 )
+        {
+            dst[ length ] = '.';
+            length += 1;
+            memory_copy ( dst + length , digits + 1 , digit_count - 1 );
+            length += digit_count - 1;
+        }
+        dst[ length ] = 'E';
+        length += 1;
+        length += string_i64 ( point - 1 , 10 , dst + length );
+    }
+
+    // CASE: Fixed notation, value < 1.
+    else if ( point <= 0 )
+    {
+        dst[ length ] = '0';
+        dst[ length + 1 ] = '.';
+        length += 2;
+        memory_set ( dst + length , '0' , -point );
+        length += -point;
+        memory_copy ( dst + length , digits , digit_count );
+        length += digit_count;
+    }
+
+    // CASE: Fixed notation, whole number.
+    else if ( ( u64 ) point >= digit_count )
+    {
+        memory_copy ( dst + length , digits , digit_count );
+        length += digit_count;
+        memory_set ( dst + length , '0' , point - digit_count );
+        length += point - digit_count;
+        dst[ length ] = '.';
+        dst[ length + 1 ] = '0';
+        length += 2;
+    }
+
+    // CASE: Fixed notation, integral and fractional parts.
+    else
+    {
+        memory_copy ( dst + length , digits , point );
+        length += point;
+        dst[ length ] = '.';
+        length += 1;
+        memory_copy ( dst + length , digits + point , digit_count - point );
+        length += digit_count - point;
+    }
+
+    return length;
+}
+
+u64
+_string_f64_fixed
+(   const f64   value
+,   const u8    precision
+,   char*       dst
+)
+{
+    union
+    {
+        f64 f;
+        u64 u;
+    }
+    bits = { .f = value };
+    const u64 ieee_mantissa = bits.u & ( ( 1ULL << STRING_F64_MANTISSA_BITS ) - 1 );
+    const u32 ieee_exponent = ( bits.u >> STRING_F64_MANTISSA_BITS )
+                            & ( ( 1U << STRING_F64_EXPONENT_BITS ) - 1 )
+                            ;
+
+    // Decode the value as m * 2^e.
+    const u64 m = ieee_exponent ? ( 1ULL << STRING_F64_MANTISSA_BITS ) | ieee_mantissa
+                                : ieee_mantissa
+                                ;
+    const i32 e = ( ieee_exponent ? ( i32 ) ieee_exponent : 1 )
+                - STRING_F64_EXPONENT_BIAS
+                - STRING_F64_MANTISSA_BITS
+                ;
+
+    // 10^precision (10^20 does not fit in 64 bits).
+    const string_u128_t scale = ( precision < 20 ) ? string_integer_powers_of_ten[ precision ]
+                                                   : ( string_u128_t ) string_integer_powers_of_ten[ 19 ] * 10
+                                                   ;
+
+    u64 integer;
+    string_u128_t fraction = 0;
+
+    // CASE: Whole number (no fractional bits).
+    if ( e >= 0 )
+    {
+        integer = m << e;
+    }
+
+    // CASE: Fractional bits present; scale them by 10^precision and round to
+    //       nearest, ties to even. A product below 2^120 shifted by 128 bits
+    //       or more is always less than one half.
+    else
+    {
+        const u32 k = -e;
+        integer = ( k < 64 ) ? m >> k : 0;
+        if ( k < 128 )
+        {
+            const u64 fraction_bits = ( k < 64 ) ? m & ( ( 1ULL << k ) - 1 ) : m;
+            const string_u128_t product = fraction_bits * scale;
+            const string_u128_t half = ( ( string_u128_t ) 1 ) << ( k - 1 );
+            const string_u128_t remainder = product & ( 2 * half - 1 );
+            fraction = product >> k;
+            const bool odd = ( precision ? ( u64 ) fraction : integer ) & 1;
+            fraction += remainder > half || ( remainder == half && odd );
+
+            // Carry into the integral part (i.e. 0.999 -> 1.00).
+            if ( fraction == scale )
+            {
+                fraction = 0;
+                integer += 1;
+            }
+        }
+    }
+
+    return _string_fixed_point ( integer , fraction , precision , dst );
+}
+
+u64
+_string_fixed_point
+(   const u64       integer
+,   string_u128_t   fraction
+,   const u8        precision
+,   char*           dst
+)
+{
+    // Integral portion.
+    u64 length = _string_u64_radix10 ( integer , dst );
+
+    // Append point.
+    dst[ length ] = '.';
+    length += 1;
+
+    // Fractional portion (with leading zeroes).
+    u64 width = precision;
+    if ( width > 19 )
+    {
+        u8 high = 0;
+        while ( fraction >= string_integer_powers_of_ten[ 19 ] )
+        {
+            fraction -= string_integer_powers_of_ten[ 19 ];
+            high += 1;
+        }
+        dst[ length ] = '0' + high;
+        length += 1;
+        width = 19;
+    }
+    if ( width )
+    {
+        const u64 digit_count = _string_u64_radix10_length ( ( u64 ) fraction );
+        memory_set ( dst + length , '0' , width - digit_count );
+        _string_u64_radix10 ( ( u64 ) fraction , dst + length + width - digit_count );
+        length += width;
+    }
+
+    return length;
+}
+
+u64
+_string_f64_abbreviated
+(   const f64   value
+,   const u8    precision
+,   char*       dst
+)
+{
+    const string_f64_decimal_t decimal = _string_f64_decimal ( value );
+    char digits[ STRING_INTEGER_MAX_LENGTH ];
+    const u64 digit_count = _string_u64_radix10 ( decimal.mantissa , digits );
+    const u64 significant = precision + 1;
+    i64 exponent = decimal.exponent + ( i64 ) digit_count - 1;
+
+    if ( digit_count > significant )
+    {
+        // Round to the requested number of significant digits (ties to even).
+        bool round_up = digits[ significant ] > '5';
+        if ( digits[ significant ] == '5' )
+        {
+            round_up = ( digits[ significant - 1 ] - '0' ) & 1;
+            for ( u64 i = significant + 1; i < digit_count; ++i )
+            {
+                if ( digits[ i ] != '0' )
+                {
+                    round_up = true;
+                    break;
+                }
+            }
+        }
+        if ( round_up )
+        {
+            u64 i = significant;
+            while ( i && digits[ i - 1 ] == '9' )
+            {
+                digits[ i - 1 ] = '0';
+                i -= 1;
+            }
+            if ( i )
+            {
+                digits[ i - 1 ] += 1;
+            }
+            else
+            {
+                // Carried past the leading digit (i.e. 9.99 -> 10.0).
+                digits[ 0 ] = '1';
+                exponent += 1;
+            }
+        }
+    }
+    else
+    {
+        memory_set ( digits + digit_count , '0' , significant - digit_count );
+    }
+
+    u64 length = 0;
+    dst[ length ] = digits[ 0 ];
+    length += 1;
+    if ( precision )
+    {
+        dst[ length ] = '.';
+        length += 1;
+        memory_copy ( dst + length , digits + 1 , precision );
+        length += precision;
+    }
+    dst[ length ] = 'E';
+    length += 1;
+    length += string_i64 ( exponent , 10 , dst + length );
+    return length;
+}
+INLINE
+string_u128_t
+_string_f64_pow5_128
+(   const i32 q
+)
+{
+    const u32 i = q - STRING_F64_PARSE_MIN_EXPONENT;
+    const u32 base = i / STRING_F64_POW5_128_TABLE_STRIDE;
+    const u32 offset = i - base * STRING_F64_POW5_128_TABLE_STRIDE;
+    const string_u128_t multiplier = ( ( string_u128_t )( string_f64_pow5_128_split[ base ][ 1 ] ) << 64 )
+                                   | string_f64_pow5_128_split[ base ][ 0 ]
+                                   ;
+    if ( !offset )
+    {
+        return multiplier;
+    }
+
+    // Multiply by the remaining power of five (192-bit product) and shift it
+    // back down to 128 bits.
+    const u64 m = string_f64_pow5[ offset ];
+    const string_u128_t low = ( string_u128_t ) m * ( u64 ) multiplier;
+    const string_u128_t high = ( string_u128_t ) m * ( u64 )( multiplier >> 64 )
+                             + ( low >> 64 )
+                             ;
+    const u32 delta = __builtin_clzll ( ( u64 )( high >> 64 ) );
+    const i32 correction = ( ( string_f64_pow5_128_offsets[ i / 16 ] >> ( ( i % 16 ) << 1 ) ) & 3 ) - 1;
+    return ( ( high << delta ) | ( ( u64 ) low >> ( 64 - delta ) ) ) + correction;
+}
+
+bool
+_string_f64_eisel_lemire
+(   u64         w
+,   const i32   q
+,   u64*        bits
+)
+{
+    // Normalize the mantissa.
+    const u32 leading_zeroes = __builtin_clzll ( w );
+    w <<= leading_zeroes;
+
+    // Multiply by the high half of the power of five. If every bit below the
+    // 55 that are kept is set, the low half may still carry into them.
+    const string_u128_t pow5 = _string_f64_pow5_128 ( q );
+    const string_u128_t product = ( string_u128_t ) w * ( u64 )( pow5 >> 64 );
+    u64 high = product >> 64;
+    u64 low = product;
+    const u64 precision_mask = ~0ULL >> ( STRING_F64_MANTISSA_BITS + 3 );
+    if ( ( high & precision_mask ) == precision_mask )
+    {
+        const u64 carry = ( ( string_u128_t ) w * ( u64 ) pow5 ) >> 64;
+        low += carry;
+        high += carry > low;
+    }
+
+    // The truncated product is only exact when 5^|q| fits in 128 bits (or its
+    // reciprocal in 64 bits); otherwise the result is undecidable here.
+    if ( low == ~0ULL && ( q < -27 || q > 55 ) )
+    {
+        return false;
+    }
+
+    const u32 upper_bit = high >> 63;
+    const u32 shift = upper_bit + 64 - STRING_F64_MANTISSA_BITS - 3;
+    u64 mantissa = high >> shift;
+    i32 exponent = ( ( 217706 * q ) >> 16 ) + 63 + upper_bit - leading_zeroes
+                 + STRING_F64_EXPONENT_BIAS
+                 ;
+
+    // CASE: Subnormal. Exact halfway cases cannot occur in this range.
+    if ( exponent <= 0 )
+    {
+        if ( 1 - exponent >= 64 )
+        {
+            *bits = 0;
+            return true;
+        }
+        mantissa >>= 1 - exponent;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+
+        // Rounding may produce the smallest normal number.
+        exponent = mantissa >= ( 1ULL << STRING_F64_MANTISSA_BITS );
+        *bits = ( mantissa & ( ( 1ULL << STRING_F64_MANTISSA_BITS ) - 1 ) )
+              | ( ( u64 ) exponent << STRING_F64_MANTISSA_BITS )
+              ;
+        return true;
+    }
+
+    // Round to nearest. An exact halfway product (only possible for small q)
+    // rounds down to even instead of up.
+    if (   low <= 1
+        && q >= -4 && q <= 23
+        && ( mantissa & 3 ) == 1
+        && ( mantissa << shift ) == high
+       )
+    {
+        mantissa &= ~1ULL;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if ( mantissa >= ( 2ULL << STRING_F64_MANTISSA_BITS ) )
+    {
+        mantissa = 1ULL << STRING_F64_MANTISSA_BITS;
+        exponent += 1;
+    }
+
+    // CASE: Overflow.
+    if ( exponent >= ( 1 << STRING_F64_EXPONENT_BITS ) - 1 )
+    {
+        *bits = ( ( 1ULL << STRING_F64_EXPONENT_BITS ) - 1 ) << STRING_F64_MANTISSA_BITS;
+        return true;
+    }
+
+    *bits = ( mantissa & ( ( 1ULL << STRING_F64_MANTISSA_BITS ) - 1 ) )
+          | ( ( u64 ) exponent << STRING_F64_MANTISSA_BITS )
+          ;
+    return true;
+}
+
+void
+_string_f64_big_decimal
+(   const char*                 mantissa
+,   const u64                   mantissa_length
+,   const i64                   exponent
+,   string_f64_big_decimal_t*   decimal
+)
+{
+    decimal->digit_count = 0;
+    decimal->point = 0;
+    decimal->truncated = false;
+
+    u64 significant = 0;
+    bool point = false;
+    for ( u64 i = 0; i < mantissa_length; ++i )
+    {
+        if ( mantissa[ i ] == '.' )
+        {
+            decimal->point = significant;
+            point = true;
+            continue;
+        }
+        const u8 digit_value = to_digit ( mantissa[ i ] );
+
+        // Leading zero.
+        if ( !significant && !digit_value )
+        {
+            decimal->point -= point;
+            continue;
+        }
+
+        if ( decimal->digit_count < STRING_F64_BIG_DECIMAL_MAX_DIGITS )
+        {
+            decimal->digits[ decimal->digit_count ] = digit_value;
+            decimal->digit_count += 1;
+        }
+        else if ( digit_value )
+        {
+            decimal->truncated = true;
+        }
+        significant += 1;
+    }
+    if ( !point )
+    {
+        decimal->point = significant;
+    }
+    decimal->point += exponent;
+
+    // Trim trailing zeroes.
+    while ( decimal->digit_count && !decimal->digits[ decimal->digit_count - 1 ] )
+    {
+        decimal->digit_count -= 1;
+    }
+}
+
+void
+_string_f64_big_decimal_shift
+(   string_f64_big_decimal_t*   decimal
+,   i32                         shift
+)
+{
+    while ( decimal->digit_count && shift )
+    {
+        u32 read;
+        u32 write;
+        u64 n = 0;
+
+        // CASE: Left shift. Digits are produced least significant first, so
+        //       write them from the end of the widest possible result.
+        if ( shift > 0 )
+        {
+            const u32 k = MIN ( shift , STRING_F64_BIG_DECIMAL_MAX_SHIFT );
+            shift -= k;
+
+            const u32 end = decimal->digit_count + ( ( k * 1233 ) >> 12 ) + 1;
+            read = decimal->digit_count;
+            write = end;
+            while ( read || n )
+            {
+                if ( read )
+                {
+                    read -= 1;
+                    n += ( ( u64 ) decimal->digits[ read ] ) << k;
+                }
+                const u64 quotient = n / 10;
+                const u8 digit_value = n - 10 * quotient;
+                n = quotient;
+                write -= 1;
+                if ( write < STRING_F64_BIG_DECIMAL_MAX_DIGITS )
+                {
+                    decimal->digits[ write ] = digit_value;
+                }
+                else if ( digit_value )
+                {
+                    decimal->truncated = true;
+                }
+            }
+            decimal->point += end - write - decimal->digit_count;
+            decimal->digit_count = MIN ( end , ( u32 ) STRING_F64_BIG_DECIMAL_MAX_DIGITS ) - write;
+            memory_move ( decimal->digits , decimal->digits + write , decimal->digit_count );
+        }
+
+        // CASE: Right shift. Digits are produced most significant first, so
+        //       they can be written in place.
+        else
+        {
+            const u32 k = MIN ( -shift , STRING_F64_BIG_DECIMAL_MAX_SHIFT );
+            shift += k;
+
+            // Read until the accumulator holds at least one output digit.
+            for ( read = 0; !( n >> k ); ++read )
+            {
+                n = 10 * n + ( ( read < decimal->digit_count ) ? decimal->digits[ read ] : 0 );
+            }
+            decimal->point -= ( i32 ) read - 1;
+
+            const u64 mask = ( 1ULL << k ) - 1;
+            for ( write = 0; read < decimal->digit_count; ++read, ++write )
+            {
+                decimal->digits[ write ] = n >> k;
+                n = 10 * ( n & mask ) + decimal->digits[ read ];
+            }
+            while ( n )
+            {
+                const u8 digit_value = n >> k;
+                if ( write < STRING_F64_BIG_DECIMAL_MAX_DIGITS )
+                {
+                    decimal->digits[ write ] = digit_value;
+                    write += 1;
+                }
+                else if ( digit_value )
+                {
+                    decimal->truncated = true;
+                }
+                n = 10 * ( n & mask );
+            }
+            decimal->digit_count = write;
+        }
+
+        // Trim trailing zeroes.
+        while ( decimal->digit_count && !decimal->digits[ decimal->digit_count - 1 ] )
+        {
+            decimal->digit_count -= 1;
+        }
+    }
+}
+
+u64
+_string_f64_big_decimal_bits
+(   string_f64_big_decimal_t* decimal
+)
+{
+    // Bit shifts which move the point by at most the given number of digits.
+    static const u8 shifts[] = { 1 , 3 , 6 , 9 , 13 , 16 , 19 , 23 , 26 };
+    const u32 shift_count = sizeof ( shifts ) / sizeof ( shifts[ 0 ] );
+    const u64 infinity = ( ( 1ULL << STRING_F64_EXPONENT_BITS ) - 1 ) << STRING_F64_MANTISSA_BITS;
+
+    if ( !decimal->digit_count || decimal->point < -330 )
+    {
+        return 0;
+    }
+    if ( decimal->point > 310 )
+    {
+        return infinity;
+    }
+
+    // Scale into [0.5..1).
+    i32 exponent = 0;
+    while ( decimal->point > 0 )
+    {
+        const i32 k = ( ( u32 ) decimal->point < shift_count ) ? shifts[ decimal->point ] : 27;
+        _string_f64_big_decimal_shift ( decimal , -k );
+        exponent += k;
+    }
+    while ( decimal->point < 0 || ( !decimal->point && decimal->digits[ 0 ] < 5 ) )
+    {
+        const i32 k = ( ( u32 ) -decimal->point < shift_count ) ? shifts[ -decimal->point ] : 27;
+        _string_f64_big_decimal_shift ( decimal , k );
+        exponent -= k;
+    }
+
+    // Floating point mantissas are in [1..2), not [0.5..1).
+    exponent -= 1;
+
+    // Denormalize below the smallest normal exponent.
+    if ( exponent < 1 - STRING_F64_EXPONENT_BIAS )
+    {
+        const i32 k = 1 - STRING_F64_EXPONENT_BIAS - exponent;
+        _string_f64_big_decimal_shift ( decimal , -k );
+        exponent += k;
+    }
+    if ( exponent + STRING_F64_EXPONENT_BIAS >= ( 1 << STRING_F64_EXPONENT_BITS ) - 1 )
+    {
+        return infinity;
+    }
+
+    // Extract the top 53 bits as an integer.
+    _string_f64_big_decimal_shift ( decimal , STRING_F64_MANTISSA_BITS + 1 );
+    u64 mantissa = 0;
+    i32 i = 0;
+    for ( ; i < decimal->point && ( u32 ) i < decimal->digit_count; ++i )
+    {
+        mantissa = 10 * mantissa + decimal->digits[ i ];
+    }
+    for ( ; i < decimal->point; ++i )
+    {
+        mantissa *= 10;
+    }
+
+    // Round to nearest, ties to even.
+    const u32 next = decimal->point;
+    if ( decimal->point >= 0 && next < decimal->digit_count )
+    {
+        if ( decimal->digits[ next ] == 5 && next + 1 == decimal->digit_count )
+        {
+            mantissa += decimal->truncated || ( mantissa & 1 );
+        }
+        else
+        {
+            mantissa += decimal->digits[ next ] >= 5;
+        }
+    }
+
+    // Rounding may carry into a new bit.
+    if ( mantissa == ( 2ULL << STRING_F64_MANTISSA_BITS ) )
+    {
+        mantissa >>= 1;
+        exponent += 1;
+        if ( exponent + STRING_F64_EXPONENT_BIAS >= ( 1 << STRING_F64_EXPONENT_BITS ) - 1 )
+        {
+            return infinity;
+        }
+    }
+
+    // CASE: Subnormal.
+    if ( !( mantissa & ( 1ULL << STRING_F64_MANTISSA_BITS ) ) )
+    {
+        exponent = -STRING_F64_EXPONENT_BIAS;
+    }
+
+    return ( mantissa & ( ( 1ULL << STRING_F64_MANTISSA_BITS ) - 1 ) )
+         | ( ( u64 )( exponent + STRING_F64_EXPONENT_BIAS ) << STRING_F64_MANTISSA_BITS )
+         ;
+}
+
+INLINE
+u64
+_string_u64_load8
+(   const char* string
+)
+{
+    u64 chunk;
+    __builtin_memcpy ( &chunk , string , sizeof ( chunk ) );
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap64 ( chunk );
+#endif
+    return chunk;
+}
+
+INLINE
+bool
+_string_u64_digits8
+(   const u64 chunk
+)
+{
+    // High nibble of every byte must be 3, and adding 6 must not carry out of
+    // the low nibble (i.e. the low nibble is at most 9).
+    return ( ( chunk & 0xF0F0F0F0F0F0F0F0ULL )
+           | ( ( ( chunk + 0x0606060606060606ULL ) & 0xF0F0F0F0F0F0F0F0ULL ) >> 4 )
+           ) == 0x3333333333333333ULL;
+}
+
+INLINE
+bool
+_string_u64_digits16
+(   const char* string
+)
+{
+    string_u64_parse_vector_t block;
+    __builtin_memcpy ( &block , string , sizeof ( block ) );
+    block = ( string_u64_parse_vector_t )( ( block - ( u8 ) '0' ) < 10 );
+
+    // Each digit is now 0xFF.
+    u64 mask[ 2 ];
+    __builtin_memcpy ( mask , &block , sizeof ( mask ) );
+    return ( mask[ 0 ] & mask[ 1 ] ) == ~0ULL;
+}
+
+INLINE
+u32
+_string_u64_parse8
+(   u64 chunk
+)
+{
+    chunk -= 0x3030303030303030ULL;
+
+    // Combine adjacent digits into two-digit values (in alternate bytes).
+    chunk = ( chunk * 10 ) + ( chunk >> 8 );
+
+    // Combine two-digit values into four-digit values, then those into one.
+    return ( ( ( chunk & 0x000000FF000000FFULL ) * ( 100 + ( 1000000ULL << 32 ) ) )
+           + ( ( ( chunk >> 16 ) & 0x000000FF000000FFULL ) * ( 1 + ( 10000ULL << 32 ) ) )
+           ) >> 32;
+}
+
+u64
+_string_u64_parse
+(   const char* string
+,   const u64   string_length
+,   u64*        value_
+)
+{
+    u64 i = 0;
+
+    // Skip leading zeroes; they do not count toward the digit limit.
+    while ( i + 8 <= string_length && _string_u64_load8 ( string + i ) == 0x3030303030303030ULL )
+    {
+        i += 8;
+    }
+    for ( ; i < string_length && string[ i ] == '0'; ++i );
+    const u64 start = i;
+
+    u64 value = 0;
+
+    // Sixteen digits at once.
+    if ( i + 16 <= string_length && _string_u64_digits16 ( string + i ) )
+    {
+        value = 100000000ULL * _string_u64_parse8 ( _string_u64_load8 ( string + i ) )
+              + _string_u64_parse8 ( _string_u64_load8 ( string + i + 8 ) )
+              ;
+        i += 16;
+    }
+
+    // Eight digits at a time, while fewer than twenty digits (the maximum for
+    // a 64-bit value) have been read.
+    while ( i - start + 8 < 20 && i + 8 <= string_length )
+    {
+        const u64 chunk = _string_u64_load8 ( string + i );
+        if ( !_string_u64_digits8 ( chunk ) )
+        {
+            break;
+        }
+        value = 100000000ULL * value + _string_u64_parse8 ( chunk );
+        i += 8;
+    }
+
+    // Remaining digits, with exact overflow detection.
+    for ( ; i < string_length && digit ( string[ i ] ); ++i )
+    {
+        if (   __builtin_mul_overflow ( value , 10 , &value )
+            || __builtin_add_overflow ( value , to_digit ( string[ i ] ) , &value )
+           )
+        {
+            return 0;
+        }
+    }
+
+    // CASE: No digits.
+    if ( !i )
+    {
+        return 0;
+    }
+
+    *value_ = value;
+    return i;
+}
+
+INLINE
+u64
+_string_array_separator
+(   const char* separator
+,   const u64   separator_length
+,   char*       dst
+)
+{
+    // Most separators are a single character; avoid the copy call for those.
+    if ( separator_length == 1 )
+    {
+        *dst = *separator;
+    }
+    else
+    {
+        memory_copy ( dst , separator , separator_length );
+    }
+    return separator_length;
+}
+
+INLINE
+u64
+_to_array_field_end
+(   const char* string
+,   const u64   string_length
+,   const char  delimiter
+)
+{
+    const char* end = __builtin_memchr ( string , delimiter , string_length );
+    return ( end ) ? ( u64 )( end - string ) : string_length;
+}
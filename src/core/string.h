@@ -20,6 +20,10 @@
 // (see string_f64).
 #define STRING_FLOAT_MAX_LENGTH    64 /** @brief Maximum stringified floating point number length. */
 #define STRING_FLOAT_MAX_PRECISION 20 /** @brief Maximum precision for string_f64 (see string_f64). */
+#define STRING_FLOAT_SHORTEST_PRECISION 255 /** @brief Precision value which requests the shortest round-trip representation (see string_f64). */
+
+// (see string_bytesize_fixed).
+#define STRING_BYTESIZE_MAX_LENGTH 29 /** @brief Maximum stringified bytesize length. */
 
 /**
  * @brief Computes the number of characters in a null-terminated string. O(n).
@@ -196,8 +200,17 @@ string_u64
 /**
  * @brief Floating point number stringify utility.
  * 
+ * If precision is STRING_FLOAT_SHORTEST_PRECISION, the shortest decimal
+ * representation which parses back to exactly the same value is written. In
+ * this mode, non-zero magnitudes below 1E-6 or of at least 1E21 are always
+ * abbreviated.
+ * 
+ * Otherwise, standard notation prints the exact binary value correctly rounded
+ * to the requested number of fractional digits (ties to even).
+ * 
  * @param value A 64-bit floating point number.
- * @param precision Floating point precision.
+ * @param precision Floating point precision, or
+ * STRING_FLOAT_SHORTEST_PRECISION.
  * @param abbreviated Use abbreviated (scientific) notation? Y/N
  * @param dst Output buffer for string. Must be non-zero. Should have access to
  * an adequate number of characters given the supplied value and precision. The
@@ -214,6 +227,84 @@ string_f64
 ,   char*   dst
 );
 
+/**
+ * @brief Bulk variant of string_u64: stringifies an array of 64-bit unsigned
+ * integers, separating the values by a separator string.
+ * 
+ * @param values The values to stringify. Must be non-zero if count is
+ * non-zero.
+ * @param count The number of values.
+ * @param radix Integer radix in the range [2..36] (inclusive).
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @param dst Output buffer for string. Must be non-zero. Should have access to
+ * count * ( STRING_INTEGER_MAX_LENGTH + separator_length ) + 1 characters to
+ * guarantee it will never overflow (+1 byte for terminator).
+ * @return The number of characters written to dst.
+ */
+u64
+string_u64_array
+(   const u64*  values
+,   const u64   count
+,   u8          radix
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
+);
+
+/**
+ * @brief Bulk variant of string_i64: stringifies an array of 64-bit signed
+ * integers, separating the values by a separator string.
+ * 
+ * @param values The values to stringify. Must be non-zero if count is
+ * non-zero.
+ * @param count The number of values.
+ * @param radix Integer radix in the range [2..36] (inclusive).
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @param dst Output buffer for string. Must be non-zero. Should have access to
+ * count * ( STRING_INTEGER_MAX_LENGTH + separator_length ) + 1 characters to
+ * guarantee it will never overflow (+1 byte for terminator).
+ * @return The number of characters written to dst.
+ */
+u64
+string_i64_array
+(   const i64*  values
+,   const u64   count
+,   u8          radix
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
+);
+
+/**
+ * @brief Bulk variant of string_f64: stringifies an array of 64-bit floating
+ * point numbers, separating the values by a separator string.
+ * 
+ * @param values The values to stringify. Must be non-zero if count is
+ * non-zero.
+ * @param count The number of values.
+ * @param precision Floating point precision, or
+ * STRING_FLOAT_SHORTEST_PRECISION.
+ * @param abbreviated Use abbreviated (scientific) notation? Y/N
+ * @param separator The string to write between values.
+ * @param separator_length The number of characters in separator.
+ * @param dst Output buffer for string. Must be non-zero. Should have access to
+ * count * ( STRING_FLOAT_MAX_LENGTH + separator_length ) + 1 characters to
+ * guarantee it will never overflow (+1 byte for terminator).
+ * @return The number of characters written to dst.
+ */
+u64
+string_f64_array
+(   const f64*  values
+,   const u64   count
+,   u8          precision
+,   const bool  abbreviated
+,   const char* separator
+,   const u64   separator_length
+,   char*       dst
+);
+
 /**
  * @brief Character stringify utility.
  * 
@@ -223,16 +314,42 @@ string_f64
 #define string_char(...) \
     ( ( char[] ){ __VA_ARGS__ , 0 } )
 
+/**
+ * @brief Bytesize unit selection.
+ * 
+ * Selects the largest unit in which size is at least one (or bytes, if size is
+ * less than 1 KiB or 1 kB).
+ * 
+ * IEC units are powers of 1024: B, KiB, MiB, GiB, TiB, PiB, EiB.
+ * SI units are powers of 1000: B, kB, MB, GB, TB, PB, EB.
+ * 
+ * @param size Size in bytes.
+ * @param si Use SI (powers of 1000) rather than IEC (powers of 1024) units?
+ * Y/N
+ * @param divisor Output buffer for the number of bytes in the selected unit.
+ * Must be non-zero.
+ * @return The unit abbreviation string.
+ */
+const char*
+string_bytesize_unit
+(   const u64   size
+,   const bool  si
+,   u64*        divisor
+);
+
 /**
  * @brief Bytesize to string.
  * 
- * Converts size into appropriate units. The unit abbreviation string is
+ * Converts size into appropriate (IEC) units. The unit abbreviation string is
  * returned, and the converted size is written into the output buffer.
  * 
+ * For an integer-only alternative which writes directly to a string buffer,
+ * see string_bytesize_fixed.
+ * 
  * @param size Size in bytes.
  * @param amount Output buffer for size (after conversion to appropriate units).
  * Must be non-zero.
- * @return "GiB" | "MiB" | "KiB" | "B"
+ * @return "EiB" | "PiB" | "TiB" | "GiB" | "MiB" | "KiB" | "B"
  */
 const char*
 string_bytesize
@@ -240,12 +357,41 @@ string_bytesize
 ,   f64*    amount
 );
 
+/**
+ * @brief Bytesize stringify utility.
+ * 
+ * Converts size into appropriate units (see string_bytesize_unit) and writes
+ * the amount, a space, and the unit abbreviation, e.g. "1.50 KiB". Uses only
+ * integer arithmetic; the amount is exactly rounded to the requested number of
+ * fractional digits (ties to even). If the amount is a whole number, no
+ * fractional part is written.
+ * 
+ * @param size Size in bytes.
+ * @param si Use SI (powers of 1000) rather than IEC (powers of 1024) units?
+ * Y/N
+ * @param precision Fractional precision in the range
+ * [0..STRING_FLOAT_MAX_PRECISION] (inclusive).
+ * @param dst Output buffer for string. Must be non-zero. Should have access to
+ * a minimum of STRING_BYTESIZE_MAX_LENGTH + 1 characters (+1 byte for
+ * terminator).
+ * @return The number of characters written to dst.
+ */
+u64
+string_bytesize_fixed
+(   u64         size
+,   const bool  si
+,   u8          precision
+,   char*       dst
+);
+
 /**
  * @brief Parses a string as a (radix-10) 64-bit signed integer.
  * 
  * Use to_i64 to explicitly specify string length, or _to_i64 to compute the
  * length of a null-terminated string before passing it to to_i64.
  * 
+ * Fails if the value does not fit in 64 bits.
+ * 
  * @param string Input string. Must be non-zero.
  * @param string_length The number of characters in string.
  * @param value Output buffer. Must be non-zero.
@@ -267,6 +413,8 @@ to_i64
  * Use to_u64 to explicitly specify string length, or _to_u64 to compute the
  * length of a null-terminated string before passing it to to_u64.
  * 
+ * Fails if the value does not fit in 64 bits.
+ * 
  * @param string Input string. Must be non-zero.
  * @param string_length The number of characters in string.
  * @param value Output buffer. Must be non-zero.
@@ -282,14 +430,55 @@ to_u64
 #define _to_u64(string,value) \
     to_u64 ( (string) , _string_length ( string ) , (value) )
 
+/**
+ * @brief Parses a (radix-10) 64-bit signed integer at the start of a string.
+ * 
+ * Leading whitespace and a sign are skipped, then the longest run of digits is
+ * parsed. Parsing stops at the first character which is not a digit, so the
+ * value may be embedded in a larger buffer.
+ * 
+ * @param string Input string. Must be non-zero.
+ * @param string_length The number of characters in string.
+ * @param value Output buffer. Must be non-zero. Only written on success.
+ * @return The number of characters consumed, or 0 if there were no digits or
+ * the value does not fit in 64 bits.
+ */
+u64
+to_i64_prefix
+(   const char* string
+,   u64         string_length
+,   i64*        value
+);
+
+/**
+ * @brief Parses a (radix-10) 64-bit unsigned integer at the start of a string.
+ * 
+ * Leading whitespace is skipped, then the longest run of digits is parsed.
+ * Parsing stops at the first character which is not a digit, so the value may
+ * be embedded in a larger buffer.
+ * 
+ * @param string Input string. Must be non-zero.
+ * @param string_length The number of characters in string.
+ * @param value Output buffer. Must be non-zero. Only written on success.
+ * @return The number of characters consumed, or 0 if there were no digits or
+ * the value does not fit in 64 bits.
+ */
+u64
+to_u64_prefix
+(   const char* string
+,   u64         string_length
+,   u64*        value
+);
+
 /**
  * @brief Parses a string as a 64-bit floating point number.
  * 
  * Use to_f64 to explicitly specify string length, or _to_f64 to compute the
  * length of a null-terminated string before passing it to to_f64.
  * 
- * Does not **currently** support abbreviated notation.
- * TODO: Implement support for abbreviated notation.
+ * Supports abbreviated notation (i.e. 1.5E10), so output from string_f64 parses
+ * back to the same value. The result is correctly rounded (ties to even);
+ * magnitudes which are out of range overflow to infinity or underflow to zero.
  * 
  * @param string Input string. Must be non-zero.
  * @param string_length The number of characters in string.
@@ -306,6 +495,90 @@ to_f64
 #define _to_f64(string,value) \
     to_f64 ( (string) , _string_length ( string ) , (value) )
 
+/**
+ * @brief Bulk variant of to_u64: parses a delimited string as an array of
+ * 64-bit unsigned integers.
+ * 
+ * Each field is parsed as by to_u64 (whitespace around a value is ignored). A
+ * whitespace-only string yields no values.
+ * 
+ * @param string Input string. Must be non-zero.
+ * @param string_length The number of characters in string.
+ * @param delimiter The character which separates fields.
+ * @param dst Output buffer for values. Must be non-zero if capacity is
+ * non-zero.
+ * @param capacity The maximum number of values dst can hold.
+ * @param count Output buffer for the number of values written to dst. Must be
+ * non-zero. On failure, this is the index of the field which failed.
+ * @return true on success; false if any field is invalid or there are more
+ * than capacity fields.
+ */
+bool
+to_u64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   u64*        dst
+,   const u64   capacity
+,   u64*        count
+);
+
+/**
+ * @brief Bulk variant of to_i64: parses a delimited string as an array of
+ * 64-bit signed integers.
+ * 
+ * Each field is parsed as by to_i64 (whitespace around a value is ignored). A
+ * whitespace-only string yields no values.
+ * 
+ * @param string Input string. Must be non-zero.
+ * @param string_length The number of characters in string.
+ * @param delimiter The character which separates fields.
+ * @param dst Output buffer for values. Must be non-zero if capacity is
+ * non-zero.
+ * @param capacity The maximum number of values dst can hold.
+ * @param count Output buffer for the number of values written to dst. Must be
+ * non-zero. On failure, this is the index of the field which failed.
+ * @return true on success; false if any field is invalid or there are more
+ * than capacity fields.
+ */
+bool
+to_i64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   i64*        dst
+,   const u64   capacity
+,   u64*        count
+);
+
+/**
+ * @brief Bulk variant of to_f64: parses a delimited string as an array of
+ * 64-bit floating point numbers.
+ * 
+ * Each field is parsed as by to_f64 (whitespace around a value is ignored). A
+ * whitespace-only string yields no values.
+ * 
+ * @param string Input string. Must be non-zero.
+ * @param string_length The number of characters in string.
+ * @param delimiter The character which separates fields.
+ * @param dst Output buffer for values. Must be non-zero if capacity is
+ * non-zero.
+ * @param capacity The maximum number of values dst can hold.
+ * @param count Output buffer for the number of values written to dst. Must be
+ * non-zero. On failure, this is the index of the field which failed.
+ * @return true on success; false if any field is invalid or there are more
+ * than capacity fields.
+ */
+bool
+to_f64_array
+(   const char* string
+,   u64         string_length
+,   const char  delimiter
+,   f64*        dst
+,   const u64   capacity
+,   u64*        count
+);
+
 /**
  * @brief Trims whitespace off front and back of a string. O(n). In-place.
  * 
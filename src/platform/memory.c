@@ -6,6 +6,27 @@
 #include "platform/memory.h"
 #include "platform/platform.h"
 
+/** @brief Type definition for a block of memory owned by an arena. */
+struct memory_arena_block_t
+{
+    memory_arena_block_t*   previous;
+    u64                     capacity;
+    u64                     offset;
+};
+
+/**
+ * @brief Allocates an empty arena block and chains it onto a previous one.
+ * 
+ * @param previous The previous block, or 0 if there is none.
+ * @param capacity The number of bytes the block is required to hold.
+ * @return The new block, or 0 if the allocation failed.
+ */
+memory_arena_block_t*
+_memory_arena_block_create
+(   memory_arena_block_t*   previous
+,   u64                     capacity
+);
+
 void*
 memory_allocate
 (   u64 size
@@ -74,4 +95,98 @@ memory_equal
 )
 {
     return platform_memory_equal ( s1 , s2 , size );
+}
+
+bool
+memory_arena_create
+(   memory_arena_t* arena
+,   u64             block_size
+)
+{
+    arena->block_size = block_size ? block_size
+                                   : MEMORY_ARENA_DEFAULT_BLOCK_SIZE
+                                   ;
+    arena->block = _memory_arena_block_create ( 0 , arena->block_size );
+    return arena->block;
+}
+
+void
+memory_arena_destroy
+(   memory_arena_t* arena
+)
+{
+    memory_arena_block_t* block = arena->block;
+    while ( block )
+    {
+        memory_arena_block_t* previous = block->previous;
+        platform_memory_free ( block );
+        block = previous;
+    }
+    arena->block = 0;
+}
+
+void*
+memory_arena_allocate
+(   memory_arena_t* arena
+,   u64             size
+)
+{
+    size = ( size + MEMORY_ARENA_ALIGNMENT - 1 ) & ~( ( u64 )( MEMORY_ARENA_ALIGNMENT - 1 ) );
+
+    memory_arena_block_t* block = arena->block;
+    if ( !block || block->offset + size > block->capacity )
+    {
+        block = _memory_arena_block_create ( block
+                                           , ( size > arena->block_size ) ? size
+                                                                          : arena->block_size
+                                           );
+        if ( !block )
+        {
+            return 0;
+        }
+        arena->block = block;
+    }
+
+    void* memory = ( ( u8* )( block + 1 ) ) + block->offset;
+    block->offset += size;
+    return memory;
+}
+
+void
+memory_arena_reset
+(   memory_arena_t* arena
+)
+{
+    memory_arena_block_t* block = arena->block;
+    if ( !block )
+    {
+        return;
+    }
+    while ( block->previous )
+    {
+        memory_arena_block_t* previous = block->previous;
+        platform_memory_free ( block );
+        block = previous;
+    }
+    block->offset = 0;
+    arena->block = block;
+}
+
+memory_arena_block_t*
+_memory_arena_block_create
+(   memory_arena_block_t*   previous
+,   u64                     capacity
+)
+{
+    memory_arena_block_t* block = platform_memory_allocate ( sizeof ( memory_arena_block_t )
+                                                           + capacity
+                                                           );
+    if ( !block )
+    {
+        return 0;
+    }
+    block->previous = previous;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
 }
\ No newline at end of file
@@ -108,4 +108,82 @@ memory_equal
 ,   u64         size
 );
 
+/** @brief Type declaration for a block of memory owned by an arena. */
+typedef struct memory_arena_block_t memory_arena_block_t;
+
+/**
+ * @brief Type definition for an arena (linear) allocator.
+ * 
+ * Allocations are carved sequentially out of large blocks and are never freed
+ * individually; memory_arena_reset releases all of them at once. When the
+ * current block is exhausted, a new block is chained onto it.
+ */
+typedef struct
+{
+    memory_arena_block_t*   block;
+    u64                     block_size;
+}
+memory_arena_t;
+
+/** @brief Defines the default arena block size in bytes. */
+#define MEMORY_ARENA_DEFAULT_BLOCK_SIZE 65536
+
+/** @brief Defines the alignment in bytes of every arena allocation. */
+#define MEMORY_ARENA_ALIGNMENT 8
+
+/**
+ * @brief Initializes an arena allocator, allocating its first block.
+ * 
+ * Uses dynamic memory allocation. Call memory_arena_destroy to free.
+ * 
+ * @param arena The arena to initialize. Must be non-zero.
+ * @param block_size The size in bytes of each block. Pass 0 to use
+ * MEMORY_ARENA_DEFAULT_BLOCK_SIZE.
+ * @return true on success; false otherwise.
+ */
+bool
+memory_arena_create
+(   memory_arena_t* arena
+,   u64             block_size
+);
+
+/**
+ * @brief Frees all memory used by an arena allocator.
+ * 
+ * @param arena The arena to free. Must be non-zero.
+ */
+void
+memory_arena_destroy
+(   memory_arena_t* arena
+);
+
+/**
+ * @brief Allocates a block of memory from an arena. Amortized O(1).
+ * 
+ * Unlike memory_allocate, the memory is not cleared. The block remains valid
+ * until the arena is reset or destroyed.
+ * 
+ * @param arena The arena to allocate from. Must be non-zero.
+ * @param size The number of bytes to allocate.
+ * @return The allocated block (aligned to MEMORY_ARENA_ALIGNMENT bytes), or 0
+ * if the arena could not grow.
+ */
+void*
+memory_arena_allocate
+(   memory_arena_t* arena
+,   u64             size
+);
+
+/**
+ * @brief Releases every allocation made from an arena at once.
+ * 
+ * The first block is kept for reuse; any blocks chained onto it are freed.
+ * 
+ * @param arena The arena to reset. Must be non-zero.
+ */
+void
+memory_arena_reset
+(   memory_arena_t* arena
+);
+
 #endif // MEMORY_H
\ No newline at end of file
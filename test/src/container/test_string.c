@@ -216,6 +216,150 @@ test_string_create_and_destroy
     return true;
 }
 
+u8
+test_string_create_local
+( void )
+{
+    u64 buffer[ 6 ];
+    const char* hello = "Hello world!";
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: _string_create_in logs an error and fails if the buffer is missing or too small.
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+    EXPECT_EQ ( 0 , _string_create_in ( 0 , sizeof ( buffer ) ) );
+    EXPECT_EQ ( 0 , _string_create_in ( buffer , ARRAY_HEADER_SIZE ) );
+
+    // TEST 2: _string_create_in creates an empty string stored in the buffer.
+    string_t* string = _string_create_in ( buffer , sizeof ( buffer ) );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( ( ( u64 ) buffer ) + ARRAY_HEADER_SIZE , ( u64 ) string );
+    EXPECT_EQ ( sizeof ( buffer ) - ARRAY_HEADER_SIZE , array_capacity ( string ) );
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    EXPECT_EQ ( 0 , *string );
+
+    // TEST 3: A string stored in a buffer stays there while it fits.
+    _string_append ( string , "Hello" );
+    EXPECT_EQ ( ( ( u64 ) buffer ) + ARRAY_HEADER_SIZE , ( u64 ) string );
+    EXPECT_EQ ( _string_length ( "Hello" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Hello" , string_length ( string ) + 1 ) );
+
+    // TEST 4: A string stored in a buffer moves to the heap once it outgrows the buffer, leaving the buffer untouched.
+    _string_append ( string , " world!" );
+    _string_append ( string , " Hello world!" );
+    EXPECT_NEQ ( ( ( u64 ) buffer ) + ARRAY_HEADER_SIZE , ( u64 ) string );
+    EXPECT_EQ ( 0 , array_flags ( string ) & ARRAY_FLAG_BORROWED );
+    EXPECT_EQ ( _string_length ( "Hello world! Hello world!" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Hello world! Hello world!" , string_length ( string ) + 1 ) );
+    EXPECT ( memory_equal ( ( ( char* ) buffer ) + ARRAY_HEADER_SIZE , "Hello" , _string_length ( "Hello" ) ) );
+    string_destroy ( string );
+
+    // TEST 5: string_create_local creates an empty string of STRING_LOCAL_CAPACITY which string_destroy does not free.
+    string = string_create_local ();
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( STRING_LOCAL_CAPACITY , array_capacity ( string ) );
+    EXPECT_NEQ ( 0 , array_flags ( string ) & ARRAY_FLAG_BORROWED );
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    _string_append ( string , hello );
+    EXPECT_EQ ( STRING_LOCAL_CAPACITY , array_capacity ( string ) );
+    EXPECT ( memory_equal ( string , hello , string_length ( string ) + 1 ) );
+    string_format_append ( string , " %u%c" , 100 , '!' );
+    EXPECT ( memory_equal ( string , "Hello world! 100!" , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_create_in_arena
+( void )
+{
+    memory_arena_t arena;
+    string_t* strings[ 100 ];
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    EXPECT ( memory_arena_create ( &arena , 256 ) ); // Verify there was no memory error prior to the test.
+
+    // TEST 1: string_create_in_arena logs an error and fails if no arena or capacity is supplied.
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+    EXPECT_EQ ( 0 , string_create_in_arena ( 0 ) );
+    EXPECT_EQ ( 0 , _string_create_in_arena ( &arena , 0 ) );
+
+    // TEST 2: memory_arena_allocate returns aligned, non-overlapping blocks, chaining a new block when the current one is exhausted.
+    u8* a = memory_arena_allocate ( &arena , 3 );
+    u8* b = memory_arena_allocate ( &arena , 1000 );
+    u8* c = memory_arena_allocate ( &arena , 1 );
+    EXPECT_NEQ ( 0 , a );
+    EXPECT_NEQ ( 0 , b );
+    EXPECT_NEQ ( 0 , c );
+    EXPECT_EQ ( 0 , ( ( u64 ) a ) % MEMORY_ARENA_ALIGNMENT );
+    EXPECT_EQ ( 0 , ( ( u64 ) b ) % MEMORY_ARENA_ALIGNMENT );
+    EXPECT_EQ ( 0 , ( ( u64 ) c ) % MEMORY_ARENA_ALIGNMENT );
+    memory_set ( a , 'a' , 3 );
+    memory_set ( b , 'b' , 1000 );
+    memory_set ( c , 'c' , 1 );
+    EXPECT_EQ ( 'a' , a[ 2 ] );
+    EXPECT_EQ ( 'b' , b[ 0 ] );
+    EXPECT_EQ ( 'b' , b[ 999 ] );
+    EXPECT_EQ ( 'c' , c[ 0 ] );
+
+    // TEST 3: memory_arena_reset reuses the first block.
+    memory_arena_reset ( &arena );
+    EXPECT_EQ ( a , memory_arena_allocate ( &arena , 8 ) );
+    memory_arena_reset ( &arena );
+
+    // TEST 4: Strings and arrays allocated from an arena behave identically to heap-allocated ones, growing within the arena.
+    for ( u64 i = 0; i < 100; ++i )
+    {
+        strings[ i ] = _string_create_in_arena ( &arena , 1 );
+        EXPECT_NEQ ( 0 , strings[ i ] ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( 0 , string_length ( strings[ i ] ) );
+        EXPECT_EQ ( ( u64 ) &arena , _array_field_get ( strings[ i ] , ARRAY_FIELD_ARENA ) );
+        string_format_append ( strings[ i ] , "Line %u: %s" , i , "Hello world!" );
+        EXPECT_EQ ( ( u64 ) &arena , _array_field_get ( strings[ i ] , ARRAY_FIELD_ARENA ) );
+    }
+    for ( u64 i = 0; i < 100; ++i )
+    {
+        char* expected = string_format ( "Line %u: %s" , i , "Hello world!" );
+        EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected ) , string_length ( strings[ i ] ) );
+        EXPECT ( memory_equal ( strings[ i ] , expected , string_length ( expected ) + 1 ) );
+        string_destroy ( expected );
+        string_destroy ( strings[ i ] ); // Does nothing.
+    }
+    u64* array = array_create_in_arena ( u64 , &arena , 1 );
+    EXPECT_NEQ ( 0 , array ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        array_push ( array , i );
+    }
+    EXPECT_EQ ( 1000 , array_length ( array ) );
+    EXPECT_EQ ( ( u64 ) &arena , _array_field_get ( array , ARRAY_FIELD_ARENA ) );
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        EXPECT_EQ ( i , array[ i ] );
+    }
+    array_destroy ( array ); // Does nothing.
+
+    // TEST 5: memory_arena_reset releases every string and array at once.
+    memory_arena_reset ( &arena );
+    EXPECT_EQ ( a , memory_arena_allocate ( &arena , 8 ) );
+
+    memory_arena_destroy ( &arena );
+    EXPECT_EQ ( 0 , arena.block );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
 u8
 test_string_append
 ( void )
@@ -974,6 +1118,46 @@ test_string_contains
     EXPECT ( string_contains ( search2 , search2_length ,  ( char[] ){ 'o' , 0 , 'w' } , sizeof ( ( char[] ){ 'o' , 0 , 'w' } ) , true , &index ) );
     EXPECT_EQ ( 4 , index );
 
+    // TEST 29: string_contains (forward and reverse) matches a reference implementation which compares every index, for substrings of every length class (single character, short, long).
+    for ( u64 i = 0; i < 2000; ++i )
+    {
+        char search[ 300 ];
+        char find[ 64 ];
+        const u64 search_length = random2 ( 0 , sizeof ( search ) );
+        const u64 find_length = random2 ( 1 , ( i % 3 ) ? 4 : sizeof ( find ) );
+        for ( u64 j = 0; j < search_length; ++j )
+        {
+            search[ j ] = random2 ( 0 , 2 ) ? 'a' : ( char ) random2 ( 0 , 255 );
+        }
+
+        // Usually, choose a substring which occurs within the string to search.
+        const u64 find_start = ( search_length >= find_length && random2 ( 0 , 3 ) ) ? random2 ( 0 , search_length - find_length ) : 0;
+        for ( u64 j = 0; j < find_length; ++j )
+        {
+            find[ j ] = ( find_start + find_length <= search_length ) ? search[ find_start + j ] : 'a';
+        }
+
+        u64 expected_forward = search_length;
+        u64 expected_reverse = search_length;
+        for ( u64 j = 0; j + find_length <= search_length; ++j )
+        {
+            if ( memory_equal ( search + j , find , find_length ) )
+            {
+                if ( expected_forward == search_length )
+                {
+                    expected_forward = j;
+                }
+                expected_reverse = j;
+            }
+        }
+        index = search_length;
+        EXPECT_EQ ( expected_forward != search_length , string_contains ( search , search_length , find , find_length , false , &index ) );
+        EXPECT_EQ ( expected_forward , index );
+        index = search_length;
+        EXPECT_EQ ( expected_reverse != search_length , string_contains ( search , search_length , find , find_length , true , &index ) );
+        EXPECT_EQ ( expected_reverse , index );
+    }
+
     // End test.
     ////////////////////////////////////////////////////////////////////////////
 
@@ -1119,6 +1303,101 @@ test_string_replace
     return true;
 }
 
+u8
+test_string_replace_multiple
+( void )
+{
+    const char* removes[] = { "{{name}}" , "{{amount}}" , "bc" , "abcd" , "b" , "" , "{{name}}" };
+    const u64 remove_lengths[] = { 8 , 10 , 2 , 4 , 1 , 0 , 8 };
+    const char* replaces[] = { "Ada" , "$5" , "1" , "2" , "3" , "zzz" , "Not used." };
+    const u64 replace_lengths[] = { 3 , 2 , 1 , 1 , 1 , 3 , 9 };
+    const char* random_removes[] = { "ab" , "ba" , "aab" , "b" , "aaaa" };
+    const u64 random_remove_lengths[] = { 2 , 2 , 3 , 1 , 4 };
+    const char* random_replaces[] = { "<0>" , "" , "ab" , "<3>" , "b" };
+    const u64 random_replace_lengths[] = { 3 , 0 , 2 , 3 , 1 };
+    char* string = string_create ();
+    char* expected;
+
+    // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , string );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: string_replace_multiple does not modify the string if no substrings are provided or none occur within it.
+    _string_append ( string , "Hello world!" );
+    string_replace_multiple ( string , removes , remove_lengths , replaces , replace_lengths , 0 );
+    EXPECT_EQ ( _string_length ( "Hello world!" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Hello world!" , string_length ( string ) + 1 ) );
+    string_replace_multiple ( string , removes , remove_lengths , replaces , replace_lengths , 2 );
+    EXPECT_EQ ( _string_length ( "Hello world!" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Hello world!" , string_length ( string ) + 1 ) );
+    string_clear ( string );
+
+    // TEST 2: string_replace_multiple replaces every occurrence of every substring in a single pass.
+    _string_append ( string , "{{name}}: {{name}} owes {{amount}} ({{unknown}}, {{name}}){{amount}}" );
+    string_replace_multiple ( string , removes , remove_lengths , replaces , replace_lengths , 2 );
+    EXPECT_EQ ( _string_length ( "Ada: Ada owes $5 ({{unknown}}, Ada)$5" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Ada: Ada owes $5 ({{unknown}}, Ada)$5" , string_length ( string ) + 1 ) );
+    string_clear ( string );
+
+    // TEST 3: string_replace_multiple replaces the leftmost match first, preferring the longest if several start at the same index, and ignores empty substrings and duplicates.
+    _string_append ( string , "xabcdxbcxb{{name}}" );
+    string_replace_multiple ( string , removes , remove_lengths , replaces , replace_lengths , 7 );
+    EXPECT_EQ ( _string_length ( "x2x1x3Ada" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "x2x1x3Ada" , string_length ( string ) + 1 ) );
+    string_clear ( string );
+
+    // TEST 4: string_replace_multiple matches a reference implementation which tries every substring at every index.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        const u64 length = random2 ( 0 , 64 );
+        for ( u64 j = 0; j < length; ++j )
+        {
+            const char c = random2 ( 0 , 2 ) ? 'a' : 'b';
+            string_append ( string , &c , 1 );
+        }
+        expected = string_create ();
+        EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+        for ( u64 j = 0; j < length; )
+        {
+            u64 match = 5;
+            for ( u64 k = 0; k < 5; ++k )
+            {
+                if (   j + random_remove_lengths[ k ] <= length
+                    && memory_equal ( string + j , random_removes[ k ] , random_remove_lengths[ k ] )
+                    && ( match == 5 || random_remove_lengths[ k ] > random_remove_lengths[ match ] )
+                   )
+                {
+                    match = k;
+                }
+            }
+            if ( match == 5 )
+            {
+                string_append ( expected , string + j , 1 );
+                j += 1;
+            }
+            else
+            {
+                string_append ( expected , random_replaces[ match ] , random_replace_lengths[ match ] );
+                j += random_remove_lengths[ match ];
+            }
+        }
+        string_replace_multiple ( string , random_removes , random_remove_lengths , random_replaces , random_replace_lengths , 5 );
+        EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) );
+        string_destroy ( expected );
+        string_clear ( string );
+    }
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    string_destroy ( string );
+
+    return true;
+}
+
 u8
 test_string_strip_escape
 ( void )
@@ -1527,6 +1806,41 @@ test_string_u64_and_i64
     EXPECT_EQ ( _string_length ( "0" ) , string_i64 ( 0 , 36 , string ) );
     EXPECT ( memory_equal ( string , "0" , _string_length ( "0" ) ) );
     
+    // TEST 29: string_u64, every radix-10 digit count boundary.
+    u64 power = 1;
+    for ( u64 i = 1; i <= 20; ++i )
+    {
+        EXPECT_EQ ( i , string_u64 ( power , 10 , string ) );
+        EXPECT_EQ ( ( u64 ) '1' , ( u64 )( string[ 0 ] ) );
+        for ( u64 j = 1; j < i; ++j )
+        {
+            EXPECT_EQ ( ( u64 ) '0' , ( u64 )( string[ j ] ) );
+        }
+        EXPECT_EQ ( 0 , string[ i ] );
+        if ( i > 1 )
+        {
+            EXPECT_EQ ( i - 1 , string_u64 ( power - 1 , 10 , string ) );
+            for ( u64 j = 0; j < i - 1; ++j )
+            {
+                EXPECT_EQ ( ( u64 ) '9' , ( u64 )( string[ j ] ) );
+            }
+            EXPECT_EQ ( 0 , string[ i - 1 ] );
+        }
+        power *= ( i < 20 ) ? 10 : 1;
+    }
+
+    // TEST 30: string_i64, smallest signed value, radix 10.
+    EXPECT_EQ ( _string_length ( "-9223372036854775808" ) , string_i64 ( ( i64 )( ( u64 ) 1 << 63 ) , 10 , string ) );
+    EXPECT ( memory_equal ( string , "-9223372036854775808" , _string_length ( "-9223372036854775808" ) + 1 ) );
+
+    // TEST 31: string_u64, power-of-two radices 4 and 32.
+    EXPECT_EQ ( _string_length ( "1132321211210012303230" ) , string_u64 ( 6521464319212 , 4 , string ) );
+    EXPECT ( memory_equal ( string , "1132321211210012303230" , _string_length ( "1132321211210012303230" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "5TPIP0R7C" ) , string_u64 ( 6521464319212 , 32 , string ) );
+    EXPECT ( memory_equal ( string , "5TPIP0R7C" , _string_length ( "5TPIP0R7C" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "FVVVVVVVVVVVV" ) , string_u64 ( 18446744073709551615U , 32 , string ) );
+    EXPECT ( memory_equal ( string , "FVVVVVVVVVVVV" , _string_length ( "FVVVVVVVVVVVV" ) + 1 ) );
+
     // End test.
     ////////////////////////////////////////////////////////////////////////////
 
@@ -1780,40 +2094,42 @@ test_string_f64
     // TEST 10: 9.999E-1.
     
     // TEST 10.1: Abbreviated.
-    EXPECT_EQ ( _string_length ( "9.999999E-1" ) , string_f64 ( 0.9999999999999999 , default_precision , true , string ) );
-    EXPECT ( memory_equal ( string , "9.999999E-1" , _string_length ( "9.999999E-1" ) ) );
+    EXPECT_EQ ( _string_length ( "1.000000E0" ) , string_f64 ( 0.9999999999999999 , default_precision , true , string ) );
+    EXPECT ( memory_equal ( string , "1.000000E0" , _string_length ( "1.000000E0" ) ) );
 
     // TEST 10.2: Default precision.
-    EXPECT_EQ ( _string_length ( "0.999999" ) , string_f64 ( 0.9999999999999999 , default_precision , false , string ) );
-    EXPECT ( memory_equal ( string , "0.999999" , _string_length ( "0.999999" ) ) );
+    EXPECT_EQ ( _string_length ( "1.000000" ) , string_f64 ( 0.9999999999999999 , default_precision , false , string ) );
+    EXPECT ( memory_equal ( string , "1.000000" , _string_length ( "1.000000" ) ) );
 
     // TEST 10.3: 0 precision.
-    EXPECT_EQ ( _string_length ( "0." ) , string_f64 ( 0.9999999999999999 , 0 , false , string ) );
-    EXPECT ( memory_equal ( string , "0." , _string_length ( "0." ) ) );
+    EXPECT_EQ ( _string_length ( "1." ) , string_f64 ( 0.9999999999999999 , 0 , false , string ) );
+    EXPECT ( memory_equal ( string , "1." , _string_length ( "1." ) ) );
 
     // TEST 10.4: 1 precision.
-    EXPECT_EQ ( _string_length ( "0.9" ) , string_f64 ( 0.9999999999999999 , 1 , false , string ) );
-    EXPECT ( memory_equal ( string , "0.9" , _string_length ( "0.9" ) ) );
+    EXPECT_EQ ( _string_length ( "1.0" ) , string_f64 ( 0.9999999999999999 , 1 , false , string ) );
+    EXPECT ( memory_equal ( string , "1.0" , _string_length ( "1.0" ) ) );
 
     // TEST 10.5: 2 precision.
-    EXPECT_EQ ( _string_length ( "0.99" ) , string_f64 ( 0.9999999999999999 , 2 , false , string ) );
-    EXPECT ( memory_equal ( string , "0.99" , _string_length ( "0.99" ) ) );
+    EXPECT_EQ ( _string_length ( "1.00" ) , string_f64 ( 0.9999999999999999 , 2 , false , string ) );
+    EXPECT ( memory_equal ( string , "1.00" , _string_length ( "1.00" ) ) );
 
     // TEST 10.6: Maximum precision.
-    // TODO: Fix rounding / precision errors that only make this accurate up to 15 fractional digits.
-    // Should be 0.99999999999999999999
-    EXPECT_EQ ( _string_length ( "0.999999999999999" ) , string_f64 ( 0.9999999999999999 , /* STRING_FLOAT_MAX_PRECISION */ 15 , false , string ) );
-    EXPECT ( memory_equal ( string , "0.999999999999999" , _string_length ( "0.999999999999999" ) ) );
+    EXPECT_EQ ( _string_length ( "0.99999999999999988898" ) , string_f64 ( 0.9999999999999999 , STRING_FLOAT_MAX_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "0.99999999999999988898" , _string_length ( "0.99999999999999988898" ) ) );
+
+    // TEST 10.7: 15 precision (rounds up into the integral part).
+    EXPECT_EQ ( _string_length ( "1.000000000000000" ) , string_f64 ( 0.9999999999999999 , 15 , false , string ) );
+    EXPECT ( memory_equal ( string , "1.000000000000000" , _string_length ( "1.000000000000000" ) ) );
 
     // TEST 11: π.
     
     // TEST 11.1: Abbreviated.
-    EXPECT_EQ ( _string_length ( "3.141592E0" ) , string_f64 ( 3.14159265358979323846 , default_precision , true , string ) );
-    EXPECT ( memory_equal ( string , "3.141592E0" , _string_length ( "3.141592E0" ) ) );
+    EXPECT_EQ ( _string_length ( "3.141593E0" ) , string_f64 ( 3.14159265358979323846 , default_precision , true , string ) );
+    EXPECT ( memory_equal ( string , "3.141593E0" , _string_length ( "3.141593E0" ) ) );
 
     // TEST 11.2: Default precision.
-    EXPECT_EQ ( _string_length ( "3.141592" ) , string_f64 ( 3.14159265358979323846 , default_precision , false , string ) );
-    EXPECT ( memory_equal ( string , "3.141592" , _string_length ( "3.141592" ) ) );
+    EXPECT_EQ ( _string_length ( "3.141593" ) , string_f64 ( 3.14159265358979323846 , default_precision , false , string ) );
+    EXPECT ( memory_equal ( string , "3.141593" , _string_length ( "3.141593" ) ) );
 
     // TEST 11.3: 0 precision.
     EXPECT_EQ ( _string_length ( "3." ) , string_f64 ( 3.14159265358979323846 , 0 , false , string ) );
@@ -1828,20 +2144,18 @@ test_string_f64
     EXPECT ( memory_equal ( string , "3.14" , _string_length ( "3.14" ) ) );
 
     // TEST 11.6: Maximum precision.
-    // TODO: Fix rounding / precision errors that only make this accurate up to 15 fractional digits.
-    // Should be 3.14159265358979323846
-    EXPECT_EQ ( _string_length ( "3.14159265358979311616" ) , string_f64 ( 3.14159265358979323846 , STRING_FLOAT_MAX_PRECISION , false , string ) );
-    EXPECT ( memory_equal ( string , "3.14159265358979311616" , _string_length ( "3.14159265358979311616" ) ) );
+    EXPECT_EQ ( _string_length ( "3.14159265358979311600" ) , string_f64 ( 3.14159265358979323846 , STRING_FLOAT_MAX_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "3.14159265358979311600" , _string_length ( "3.14159265358979311600" ) ) );
 
     // TEST 12: -π.
     
     // TEST 12.1: Abbreviated.
-    EXPECT_EQ ( _string_length ( "-3.141592E0" ) , string_f64 ( -3.14159265358979323846 , default_precision , true , string ) );
-    EXPECT ( memory_equal ( string , "-3.141592E0" , _string_length ( "-3.141592E0" ) ) );
+    EXPECT_EQ ( _string_length ( "-3.141593E0" ) , string_f64 ( -3.14159265358979323846 , default_precision , true , string ) );
+    EXPECT ( memory_equal ( string , "-3.141593E0" , _string_length ( "-3.141593E0" ) ) );
 
     // TEST 12.2: Default precision.
-    EXPECT_EQ ( _string_length ( "-3.141592" ) , string_f64 ( -3.14159265358979323846 , default_precision , false , string ) );
-    EXPECT ( memory_equal ( string , "-3.141592" , _string_length ( "-3.141592" ) ) );
+    EXPECT_EQ ( _string_length ( "-3.141593" ) , string_f64 ( -3.14159265358979323846 , default_precision , false , string ) );
+    EXPECT ( memory_equal ( string , "-3.141593" , _string_length ( "-3.141593" ) ) );
 
     // TEST 12.3: 0 precision.
     EXPECT_EQ ( _string_length ( "-3." ) , string_f64 ( -3.14159265358979323846 , 0 , false , string ) );
@@ -1856,10 +2170,8 @@ test_string_f64
     EXPECT ( memory_equal ( string , "-3.14" , _string_length ( "-3.14" ) ) );
 
     // TEST 12.6: Maximum precision.
-    // TODO: Fix rounding / precision errors that only make this accurate up to 15 fractional digits.
-    // Should be 3.14159265358979323846
-    EXPECT_EQ ( _string_length ( "-3.14159265358979311616" ) , string_f64 ( -3.14159265358979323846 , STRING_FLOAT_MAX_PRECISION , false , string ) );
-    EXPECT ( memory_equal ( string , "-3.14159265358979311616" , _string_length ( "-3.14159265358979311616" ) ) );
+    EXPECT_EQ ( _string_length ( "-3.14159265358979311600" ) , string_f64 ( -3.14159265358979323846 , STRING_FLOAT_MAX_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "-3.14159265358979311600" , _string_length ( "-3.14159265358979311600" ) ) );
     
     // TEST 13: -0.01
 
@@ -1884,8 +2196,82 @@ test_string_f64
     EXPECT ( memory_equal ( string , "-0.01" , _string_length ( "-0.01" ) ) );
 
     // TEST 13.6: Maximum precision.
-    EXPECT_EQ ( _string_length ( "-0.01000000000000000000" ) , string_f64 ( -0.01 , STRING_FLOAT_MAX_PRECISION , false , string ) );
-    EXPECT ( memory_equal ( string , "-0.01000000000000000000" , _string_length ( "-0.01000000000000000000" ) ) );
+    EXPECT_EQ ( _string_length ( "-0.01000000000000000021" ) , string_f64 ( -0.01 , STRING_FLOAT_MAX_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "-0.01000000000000000021" , _string_length ( "-0.01000000000000000021" ) ) );
+
+    // TEST 14: Shortest round-trip representation.
+
+    // TEST 14.1: Zero.
+    EXPECT_EQ ( _string_length ( "0.0" ) , string_f64 ( 0.0 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "0.0" , _string_length ( "0.0" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "0.0" ) , string_f64 ( 0.0 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "0.0" , _string_length ( "0.0" ) + 1 ) );
+
+    // TEST 14.2: 0.1.
+    EXPECT_EQ ( _string_length ( "0.1" ) , string_f64 ( 0.1 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "0.1" , _string_length ( "0.1" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E-1" ) , string_f64 ( 0.1 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E-1" , _string_length ( "1E-1" ) + 1 ) );
+
+    // TEST 14.3: Misc. negative value.
+    EXPECT_EQ ( _string_length ( "-100098.7893573" ) , string_f64 ( -100098.7893573 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "-100098.7893573" , _string_length ( "-100098.7893573" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "-1.000987893573E5" ) , string_f64 ( -100098.7893573 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "-1.000987893573E5" , _string_length ( "-1.000987893573E5" ) + 1 ) );
+
+    // TEST 14.4: 0.9999999999999999.
+    EXPECT_EQ ( _string_length ( "0.9999999999999999" ) , string_f64 ( 0.9999999999999999 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "0.9999999999999999" , _string_length ( "0.9999999999999999" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "9.999999999999999E-1" ) , string_f64 ( 0.9999999999999999 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "9.999999999999999E-1" , _string_length ( "9.999999999999999E-1" ) + 1 ) );
+
+    // TEST 14.5: Whole number.
+    EXPECT_EQ ( _string_length ( "123456.0" ) , string_f64 ( 123456.0 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "123456.0" , _string_length ( "123456.0" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1.23456E5" ) , string_f64 ( 123456.0 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1.23456E5" , _string_length ( "1.23456E5" ) + 1 ) );
+
+    // TEST 14.6: 1E-6 (smallest magnitude printed in fixed notation).
+    EXPECT_EQ ( _string_length ( "0.000001" ) , string_f64 ( 0.000001 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "0.000001" , _string_length ( "0.000001" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E-6" ) , string_f64 ( 0.000001 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E-6" , _string_length ( "1E-6" ) + 1 ) );
+
+    // TEST 14.7: 1E-7 (force-abbreviated).
+    EXPECT_EQ ( _string_length ( "1E-7" ) , string_f64 ( 0.0000001 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "1E-7" , _string_length ( "1E-7" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E-7" ) , string_f64 ( 0.0000001 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E-7" , _string_length ( "1E-7" ) + 1 ) );
+
+    // TEST 14.8: 1E20 (largest power of ten printed in fixed notation).
+    EXPECT_EQ ( _string_length ( "100000000000000000000.0" ) , string_f64 ( 1E20 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "100000000000000000000.0" , _string_length ( "100000000000000000000.0" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E20" ) , string_f64 ( 1E20 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E20" , _string_length ( "1E20" ) + 1 ) );
+
+    // TEST 14.9: 1E21 (force-abbreviated).
+    EXPECT_EQ ( _string_length ( "1E21" ) , string_f64 ( 1E21 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "1E21" , _string_length ( "1E21" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E21" ) , string_f64 ( 1E21 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E21" , _string_length ( "1E21" ) + 1 ) );
+
+    // TEST 14.10: 1E23 (nearest value is below 1E23).
+    EXPECT_EQ ( _string_length ( "1E23" ) , string_f64 ( 1E23 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "1E23" , _string_length ( "1E23" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1E23" ) , string_f64 ( 1E23 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1E23" , _string_length ( "1E23" ) + 1 ) );
+
+    // TEST 14.11: Smallest subnormal value.
+    EXPECT_EQ ( _string_length ( "5E-324" ) , string_f64 ( 5E-324 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "5E-324" , _string_length ( "5E-324" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "5E-324" ) , string_f64 ( 5E-324 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "5E-324" , _string_length ( "5E-324" ) + 1 ) );
+
+    // TEST 14.12: Maximum value.
+    EXPECT_EQ ( _string_length ( "1.7976931348623157E308" ) , string_f64 ( 1.7976931348623157E308 , STRING_FLOAT_SHORTEST_PRECISION , false , string ) );
+    EXPECT ( memory_equal ( string , "1.7976931348623157E308" , _string_length ( "1.7976931348623157E308" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "1.7976931348623157E308" ) , string_f64 ( 1.7976931348623157E308 , STRING_FLOAT_SHORTEST_PRECISION , true , string ) );
+    EXPECT ( memory_equal ( string , "1.7976931348623157E308" , _string_length ( "1.7976931348623157E308" ) + 1 ) );
 
     // End test.
     ////////////////////////////////////////////////////////////////////////////
@@ -1955,11 +2341,21 @@ test_to_u64
     // TEST 12: Mixed whitespace and zeroes fails.
     EXPECT_NOT ( _to_u64 ( "0 000000000023428476892  " , &out ) );
 
-    // TEST 13: Value too long.
-    // TODO: Invalidate this instead of returning garbage.
+    // TEST 13: Value too long fails.
     out = 0;
-    EXPECT ( _to_u64 ( "00018446744073709551615000" , &out ) );
-    EXPECT_EQ ( 18446744073709551615U , out );
+    EXPECT_NOT ( _to_u64 ( "00018446744073709551615000" , &out ) );
+    EXPECT_EQ ( 0 , out );
+
+    // TEST 14: Overflow by one fails.
+    EXPECT_NOT ( _to_u64 ( "18446744073709551616" , &out ) );
+
+    // TEST 15: Sixteen or more digits (with leading zeroes).
+    out = 0;
+    EXPECT ( _to_u64 ( "0000000000000000001234567890123456789" , &out ) );
+    EXPECT_EQ ( 1234567890123456789U , out );
+
+    // TEST 16: Non-digit after sixteen digits fails.
+    EXPECT_NOT ( _to_u64 ( "1234567890123456x" , &out ) );
 
     // End test.
     ////////////////////////////////////////////////////////////////////////////
@@ -2061,11 +2457,72 @@ test_to_i64
     // TEST 19: Mixed whitespace and zeroes fails.
     EXPECT_NOT ( _to_i64 ( "+0 000000000023428476892  " , &out ) );
 
-    // TEST 20: Value too long.
-    // TODO: Invalidate this instead of returning garbage.
+    // TEST 20: Value too long fails.
     out = 0;
-    EXPECT ( _to_i64 ( "18446744073709551615" , &out ) );
-    EXPECT_EQ ( -1 , out );
+    EXPECT_NOT ( _to_i64 ( "18446744073709551615" , &out ) );
+    EXPECT_EQ ( 0 , out );
+
+    // TEST 21: Overflow by one fails.
+    EXPECT_NOT ( _to_i64 ( "9223372036854775808" , &out ) );
+    EXPECT_NOT ( _to_i64 ( "-9223372036854775809" , &out ) );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_to_u64_and_i64_prefix
+( void )
+{
+    const char* string = "  -123,456 789xyz";
+    const u64 string_length = _string_length ( string );
+    u64 u64_out;
+    i64 i64_out;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: Empty string fails.
+    EXPECT_EQ ( 0 , to_u64_prefix ( "" , 0 , &u64_out ) );
+    EXPECT_EQ ( 0 , to_i64_prefix ( "" , 0 , &i64_out ) );
+
+    // TEST 2: No leading digits fails.
+    EXPECT_EQ ( 0 , to_u64_prefix ( string , string_length , &u64_out ) );
+    EXPECT_EQ ( 0 , to_i64_prefix ( string + 14 , string_length - 14 , &i64_out ) );
+
+    // TEST 3: Values embedded in a larger buffer.
+    i64_out = 0;
+    EXPECT_EQ ( 6 , to_i64_prefix ( string , string_length , &i64_out ) );
+    EXPECT_EQ ( -123 , i64_out );
+    u64_out = 0;
+    EXPECT_EQ ( 3 , to_u64_prefix ( string + 7 , string_length - 7 , &u64_out ) );
+    EXPECT_EQ ( 456 , u64_out );
+    u64_out = 0;
+    EXPECT_EQ ( 4 , to_u64_prefix ( string + 10 , string_length - 10 , &u64_out ) );
+    EXPECT_EQ ( 789 , u64_out );
+
+    // TEST 4: Length limits the digits consumed.
+    u64_out = 0;
+    EXPECT_EQ ( 2 , to_u64_prefix ( "12345678901234567890" , 2 , &u64_out ) );
+    EXPECT_EQ ( 12 , u64_out );
+
+    // TEST 5: Long values embedded in a larger buffer.
+    u64_out = 0;
+    EXPECT_EQ ( 20 , to_u64_prefix ( "18446744073709551615;" , 21 , &u64_out ) );
+    EXPECT_EQ ( 18446744073709551615U , u64_out );
+    i64_out = 0;
+    EXPECT_EQ ( 20 , to_i64_prefix ( "-9223372036854775808;" , 21 , &i64_out ) );
+    EXPECT_EQ ( -9223372036854775807 - 1 , i64_out );
+
+    // TEST 6: Overflow fails, and leaves the output buffer unchanged.
+    u64_out = 1;
+    EXPECT_EQ ( 0 , to_u64_prefix ( "18446744073709551616;" , 21 , &u64_out ) );
+    EXPECT_EQ ( 1 , u64_out );
+    i64_out = 1;
+    EXPECT_EQ ( 0 , to_i64_prefix ( "9223372036854775808;" , 20 , &i64_out ) );
+    EXPECT_EQ ( 1 , i64_out );
 
     // End test.
     ////////////////////////////////////////////////////////////////////////////
@@ -2234,46 +2691,39 @@ test_to_f64
     EXPECT_EQF ( 0.0987654321 , out , tolerance );
 
     // TEST 35: Minimum 64-bit signed value.
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "-9223372036854775808" , &out ) );
-    EXPECT_EQF ( -9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( -9223372036854775808.0 , out , tolerance );
 
     // TEST 36: Minimum 64-bit signed value (with whitespace).
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "   -9223372036854775808\n\t" , &out ) );
-    EXPECT_EQF ( -9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( -9223372036854775808.0 , out , tolerance );
 
     // TEST 37: Minimum 64-bit signed value (with leading and trailing zeroes).
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "-00000000009223372036854775808.0000\n\t" , &out ) );
-    EXPECT_EQF ( -9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( -9223372036854775808.0 , out , tolerance );
 
     // TEST 38: Maximum 64-bit signed value.
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "9223372036854775807" , &out ) );
-    EXPECT_EQF ( 9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( 9223372036854775808.0 , out , tolerance );
 
     // TEST 39: Maximum 64-bit signed value (with whitespace).
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "   9223372036854775807\n\t" , &out ) );
-    EXPECT_EQF ( 9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( 9223372036854775808.0 , out , tolerance );
 
     // TEST 40: Maximum 64-bit signed value (with leading and trailing zeroes).
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "00000000009223372036854775807.0000\n\t" , &out ) );
-    EXPECT_EQF ( 9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( 9223372036854775808.0 , out , tolerance );
 
     // TEST 41: Maximum 64-bit signed value (with sign).
-    // TODO: Fix lossy conversion here.
     out = 0.0;
     EXPECT ( _to_f64 ( "+9223372036854775808." , &out ) );
-    EXPECT_EQF ( 9223372036854778240.0 , out , tolerance );
+    EXPECT_EQF ( 9223372036854775808.0 , out , tolerance );
 
     // TEST 42: Misc. value.
     out = 0.0;
@@ -2295,9 +2745,176 @@ test_to_f64
     EXPECT ( _to_f64 ( "+4294967295.12345" , &out ) );
     EXPECT_EQF ( 4294967295.12345 , out , tolerance );
 
-    // TEST 46: Value which is too long fails.
-    // TODO: Implement abbreviated notation handler to support these values.
-    EXPECT_NOT ( _to_f64 ( "10000000000000000000." , &out ) );
+    // TEST 46: Value with more than 19 integral digits.
+    out = 0.0;
+    EXPECT ( _to_f64 ( "10000000000000000000." , &out ) );
+    EXPECT_EQF ( 1E19 , out , 0 );
+
+    // TEST 47: Abbreviated notation.
+    out = 0.0;
+    EXPECT ( _to_f64 ( "1.5E10" , &out ) );
+    EXPECT_EQF ( 1.5E10 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "  -2.5e-3\n\t" , &out ) );
+    EXPECT_EQF ( -2.5E-3 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "+.5E+2" , &out ) );
+    EXPECT_EQF ( 50.0 , out , 0 );
+
+    // TEST 48: Malformed abbreviated notation fails.
+    EXPECT_NOT ( _to_f64 ( "1E" , &out ) );
+    EXPECT_NOT ( _to_f64 ( "1E+" , &out ) );
+    EXPECT_NOT ( _to_f64 ( "E5" , &out ) );
+    EXPECT_NOT ( _to_f64 ( ".E5" , &out ) );
+    EXPECT_NOT ( _to_f64 ( "1E5.0" , &out ) );
+    EXPECT_NOT ( _to_f64 ( "1.2.3" , &out ) );
+
+    // TEST 49: Results are correctly rounded (ties to even).
+    out = 0.0;
+    EXPECT ( _to_f64 ( "0.1" , &out ) );
+    EXPECT_EQF ( 0.1 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "9007199254740993" , &out ) );
+    EXPECT_EQF ( 9007199254740992.0 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "9007199254740993.00000000000000000000000000000001" , &out ) );
+    EXPECT_EQF ( 9007199254740994.0 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "1.7976931348623157E308" , &out ) );
+    EXPECT_EQF ( 1.7976931348623157E308 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "2.2250738585072011E-308" , &out ) );
+    EXPECT_EQF ( 2.2250738585072011E-308 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "4.9E-324" , &out ) );
+    EXPECT_EQF ( 4.9E-324 , out , 0 );
+
+    // TEST 50: Out-of-range magnitudes overflow to infinity or underflow to zero.
+    out = 0.0;
+    EXPECT ( _to_f64 ( "1E309" , &out ) );
+    EXPECT_EQF ( INFINITY_64 , out , 0 );
+    out = 0.0;
+    EXPECT ( _to_f64 ( "-1E309" , &out ) );
+    EXPECT_EQF ( -INFINITY_64 , out , 0 );
+    out = 1.0;
+    EXPECT ( _to_f64 ( "1E-400" , &out ) );
+    EXPECT_EQF ( 0.0 , out , 0 );
+
+    // TEST 51: Inverse of string_f64 (abbreviated and shortest round-trip notation).
+    char string[ STRING_FLOAT_MAX_LENGTH + 1 ];
+    const f64 values[] = { 3.14159265358979323846 , -0.01 , 8723941230947.678234 , 1E-300 , 6.02214076E23 };
+    for ( u64 i = 0; i < sizeof ( values ) / sizeof ( values[ 0 ] ); ++i )
+    {
+        out = 0.0;
+        EXPECT ( to_f64 ( string , string_f64 ( values[ i ] , STRING_FLOAT_SHORTEST_PRECISION , true , string ) , &out ) );
+        EXPECT_EQF ( values[ i ] , out , 0 );
+        out = 0.0;
+        EXPECT ( to_f64 ( string , string_f64 ( values[ i ] , 16 , true , string ) , &out ) );
+        EXPECT_EQF ( values[ i ] , out , 0 );
+    }
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_and_to_array
+( void )
+{
+    const u64 u64_in[] = { 0 , 7 , 18446744073709551615U , 1000000 };
+    const i64 i64_in[] = { -9223372036854775807 - 1 , -1 , 0 , 42 };
+    const f64 f64_in[] = { 0.5 , -2.25 , 1E300 , 3.0 };
+    char buffer[ 4 * ( STRING_FLOAT_MAX_LENGTH + 2 ) + 1 ];
+    u64 u64_out[ 4 ];
+    i64 i64_out[ 4 ];
+    f64 f64_out[ 4 ];
+    u64 count;
+    char* string;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: Bulk stringify matches the single-value stringify functions.
+    EXPECT_EQ ( _string_length ( "0, 7, 18446744073709551615, 1000000" ) , string_u64_array ( u64_in , 4 , 10 , ", " , 2 , buffer ) );
+    EXPECT ( memory_equal ( buffer , "0, 7, 18446744073709551615, 1000000" , _string_length ( "0, 7, 18446744073709551615, 1000000" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "-9223372036854775808;-1;0;42" ) , string_i64_array ( i64_in , 4 , 10 , ";" , 1 , buffer ) );
+    EXPECT ( memory_equal ( buffer , "-9223372036854775808;-1;0;42" , _string_length ( "-9223372036854775808;-1;0;42" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "0|7|FFFFFFFFFFFFFFFF|F4240" ) , string_u64_array ( u64_in , 4 , 16 , "|" , 1 , buffer ) );
+    EXPECT ( memory_equal ( buffer , "0|7|FFFFFFFFFFFFFFFF|F4240" , _string_length ( "0|7|FFFFFFFFFFFFFFFF|F4240" ) + 1 ) );
+    EXPECT_EQ ( _string_length ( "0.5 -2.25 1E300 3.0" ) , string_f64_array ( f64_in , 4 , STRING_FLOAT_SHORTEST_PRECISION , false , " " , 1 , buffer ) );
+    EXPECT ( memory_equal ( buffer , "0.5 -2.25 1E300 3.0" , _string_length ( "0.5 -2.25 1E300 3.0" ) + 1 ) );
+
+    // TEST 2: Bulk stringify of an empty array writes only the terminator.
+    EXPECT_EQ ( 0 , string_u64_array ( u64_in , 0 , 10 , "," , 1 , buffer ) );
+    EXPECT_EQ ( 0 , buffer[ 0 ] );
+
+    // TEST 3: Bulk parse round-trips bulk stringify.
+    count = 0;
+    EXPECT ( to_u64_array ( "0, 7, 18446744073709551615, 1000000" , _string_length ( "0, 7, 18446744073709551615, 1000000" ) , ',' , u64_out , 4 , &count ) );
+    EXPECT_EQ ( 4 , count );
+    EXPECT ( memory_equal ( u64_out , u64_in , sizeof ( u64_in ) ) );
+    count = 0;
+    EXPECT ( to_i64_array ( "-9223372036854775808;-1;0;42" , _string_length ( "-9223372036854775808;-1;0;42" ) , ';' , i64_out , 4 , &count ) );
+    EXPECT_EQ ( 4 , count );
+    EXPECT ( memory_equal ( i64_out , i64_in , sizeof ( i64_in ) ) );
+    count = 0;
+    EXPECT ( to_f64_array ( "0.5 -2.25 1E300 3.0" , _string_length ( "0.5 -2.25 1E300 3.0" ) , ' ' , f64_out , 4 , &count ) );
+    EXPECT_EQ ( 4 , count );
+    EXPECT ( memory_equal ( f64_out , f64_in , sizeof ( f64_in ) ) );
+
+    // TEST 4: Bulk parse reports the index of the first invalid field.
+    count = 0;
+    EXPECT_NOT ( to_u64_array ( "1,2,x,4" , _string_length ( "1,2,x,4" ) , ',' , u64_out , 4 , &count ) );
+    EXPECT_EQ ( 2 , count );
+    count = 0;
+    EXPECT_NOT ( to_i64_array ( "1,,3" , _string_length ( "1,,3" ) , ',' , i64_out , 4 , &count ) );
+    EXPECT_EQ ( 1 , count );
+    count = 0;
+    EXPECT_NOT ( to_u64_array ( "1,2,3,4,5" , _string_length ( "1,2,3,4,5" ) , ',' , u64_out , 4 , &count ) );
+    EXPECT_EQ ( 4 , count );
+
+    // TEST 5: Bulk parse of a whitespace-only string yields no values.
+    count = 1;
+    EXPECT ( to_f64_array ( "   " , 3 , ',' , f64_out , 4 , &count ) );
+    EXPECT_EQ ( 0 , count );
+
+    // TEST 6: Appending an array to a resizable string.
+    string = string_create_from ( "values: " );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    string = __string_append_u64_array ( string , u64_in , 4 , 10 , ", " , 2 );
+    EXPECT_EQ ( _string_length ( "values: 0, 7, 18446744073709551615, 1000000" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "values: 0, 7, 18446744073709551615, 1000000" , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+
+    // TEST 7: Appending an array larger than one reservation block matches per-element appends.
+    {
+        i64* i64_array_in = array_create ( i64 , 3000 );
+        EXPECT_NEQ ( 0 , i64_array_in ); // Verify there was no memory error prior to the test.
+        for ( u64 i = 0; i < 3000; ++i )
+        {
+            array_push ( i64_array_in , ( ( i64 ) i ) * -4398046511 );
+        }
+        char* expected = string_create ();
+        EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+        for ( u64 i = 0; i < 3000; ++i )
+        {
+            if ( i )
+            {
+                string_append ( expected , ", " , 2 );
+            }
+            string_append ( expected , buffer , string_i64 ( i64_array_in[ i ] , 10 , buffer ) );
+        }
+        string = string_create ();
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        string_append_i64_array ( string , i64_array_in , 10 , ", " , 2 );
+        EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) );
+        string_destroy ( string );
+        string_destroy ( expected );
+        array_destroy ( i64_array_in );
+    }
 
     // End test.
     ////////////////////////////////////////////////////////////////////////////
@@ -2521,17 +3138,16 @@ test_string_format
     float_in = 8723941230947.678234563498562343478952734523495893245723495782349057897563274632589346;
     string = string_format ( "%+f" , &float_in );
     EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
-    EXPECT_EQ ( _string_length ( "+8723941230947.678710" ) , string_length ( string ) );
-    EXPECT ( memory_equal ( string , "+8723941230947.678710" , string_length ( string ) ) );
+    EXPECT_EQ ( _string_length ( "+8723941230947.678711" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "+8723941230947.678711" , string_length ( string ) ) );
     string_destroy ( string );
 
     // TEST 23: Floating point (abbreviated-notation) format specifier, with fix-precision and show-sign modifiers. Positive number.
-    // TODO: Fix rounding errors with string_f64. Should be +8.723941230947679E12
     float_in = 8723941230947.678234563498562343478952734523495893245723495782349057897563274632589346;
     string = string_format ( "%+.15e" , &float_in );
     EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
-    EXPECT_EQ ( _string_length ( "+8.723941230947678E12" ) , string_length ( string ) );
-    EXPECT ( memory_equal ( string , "+8.723941230947678E12" , string_length ( string ) ) );
+    EXPECT_EQ ( _string_length ( "+8.723941230947679E12" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "+8.723941230947679E12" , string_length ( string ) ) );
     string_destroy ( string );
 
     // TEST 24: Floating point (fractional only) format specifier.
@@ -2543,12 +3159,11 @@ test_string_format
     string_destroy ( string );
     
     // TEST 25: Floating point (abbreviated-notation) format specifier.
-    // TODO: Fix rounding errors with string_f64. Should be -1.000988E5.
     float_in = -100098.7893573;
     string = string_format ( "%e" , &float_in );
     EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
-    EXPECT_EQ ( _string_length ( "-1.000987E5" ) , string_length ( string ) );
-    EXPECT ( memory_equal ( string , "-1.000987E5" , string_length ( string ) ) );
+    EXPECT_EQ ( _string_length ( "-1.000988E5" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "-1.000988E5" , string_length ( string ) ) );
     string_destroy ( string );
 
     // TEST 26: Fixed-column-width format modifier, width == 80, pad left with '0'.
@@ -3574,15 +4189,15 @@ test_string_format
     // TEST 137: Bytesize format specifier.
     string = string_format ( "%size | %size | %size | %size | %size | %size | %size | %size" , KiB ( 1 ) - 1 , KiB ( 1 ) , MiB ( 1 ) - 1 , MiB ( 1 ) , GiB ( 1 ) - 1 , GiB ( 1 ) , KiB ( 1400 ) , GiB ( 400.25 ) );
     EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
-    EXPECT_EQ ( _string_length ( "1023 B | 1 KiB | 1023.999023 KiB | 1 MiB | 1023.999999 MiB | 1 GiB | 1.367187 MiB | 400.250000 GiB" ) , string_length ( string ) );
-    EXPECT ( memory_equal ( string , "1023 B | 1 KiB | 1023.999023 KiB | 1 MiB | 1023.999999 MiB | 1 GiB | 1.367187 MiB | 400.250000 GiB" , string_length ( string ) ) );
+    EXPECT_EQ ( _string_length ( "1023 B | 1 KiB | 1023.999023 KiB | 1 MiB | 1023.999999 MiB | 1 GiB | 1.367188 MiB | 400.250000 GiB" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "1023 B | 1 KiB | 1023.999023 KiB | 1 MiB | 1023.999999 MiB | 1 GiB | 1.367188 MiB | 400.250000 GiB" , string_length ( string ) ) );
     string_destroy ( string );
 
     // TEST 138: Bytesize format modifier, with fix-precision modifier.
     string = string_format ( "%.2size | %.2size | %.2size | %.2size | %.2size | %.2size | %.2size | %.2size" , KiB ( 1 ) - 1 , KiB ( 1 ) , MiB ( 1 ) - 1 , MiB ( 1 ) , GiB ( 1 ) - 1 , GiB ( 1 ) , KiB ( 1400 ) , GiB ( 400.25 ) );
     EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
-    EXPECT_EQ ( _string_length ( "1023 B | 1 KiB | 1023.99 KiB | 1 MiB | 1023.99 MiB | 1 GiB | 1.36 MiB | 400.25 GiB" ) , string_length ( string ) );
-    EXPECT ( memory_equal ( string , "1023 B | 1 KiB | 1023.99 KiB | 1 MiB | 1023.99 MiB | 1 GiB | 1.36 MiB | 400.25 GiB" , string_length ( string ) ) );
+    EXPECT_EQ ( _string_length ( "1023 B | 1 KiB | 1024.00 KiB | 1 MiB | 1024.00 MiB | 1 GiB | 1.37 MiB | 400.25 GiB" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "1023 B | 1 KiB | 1024.00 KiB | 1 MiB | 1024.00 MiB | 1 GiB | 1.37 MiB | 400.25 GiB" , string_length ( string ) ) );
     string_destroy ( string );
 
     // TEST 139: Empty nested format substring, standalone (no padding).
@@ -3612,6 +4227,234 @@ test_string_format
     EXPECT ( memory_equal ( string , "%a{    }" , string_length ( string ) ) );
     string_destroy ( string );
 
+    // TEST 142: Format specifiers are found at any position within a long literal span.
+    for ( u64 i = 0; i < 40; ++i )
+    {
+        char format[ 42 ];
+        char expected[ 41 ];
+        memory_set ( format , '-' , 41 );
+        memory_set ( expected , '-' , 40 );
+        format[ i ] = '%';
+        format[ i + 1 ] = 'c';
+        format[ 41 ] = 0;
+        expected[ i ] = 'x';
+        expected[ 40 ] = 0;
+        string = string_format ( format , 'x' );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( _string_length ( expected ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected , string_length ( string ) ) );
+        string_destroy ( string );
+    }
+
+    // TEST 143: Collection format modifiers print arrays whose output exceeds any internal buffer, including elements which are each longer than it.
+    {
+        u16* u16_array_in = array_create ( u16 , 3000 );
+        i64* i64_array_in = array_create ( i64 , 3000 );
+        EXPECT_NEQ ( 0 , u16_array_in ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , i64_array_in ); // Verify there was no memory error prior to the test.
+        for ( u64 i = 0; i < 3000; ++i )
+        {
+            array_push ( u16_array_in , i * 21 );
+            array_push ( i64_array_in , ( ( i64 ) i ) * -4398046511 );
+        }
+        char* expected_u16 = string_create_from ( "{" );
+        char* expected_i64 = string_create_from ( "<" );
+        char* expected_pad = string_create_from ( "{ " );
+        EXPECT_NEQ ( 0 , expected_u16 ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_i64 ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_pad ); // Verify there was no memory error prior to the test.
+        for ( u64 i = 0; i < 3000; ++i )
+        {
+            string = string_format ( ( i ) ? "|%u" : "%u" , u16_array_in[ i ] );
+            _string_append ( expected_u16 , string );
+            string_destroy ( string );
+            string = string_format ( ( i ) ? "[, ]%i" : "%i" , i64_array_in[ i ] );
+            _string_append ( expected_i64 , string );
+            string_destroy ( string );
+        }
+        for ( u64 i = 0; i < 3; ++i )
+        {
+            string = string_format ( ( i ) ? ", %Pl 5000i" : "%Pl 5000i" , i64_array_in[ i ] );
+            _string_append ( expected_pad , string );
+            string_destroy ( string );
+        }
+        string_append ( expected_u16 , "}" , 1 );
+        string_append ( expected_i64 , ">" , 1 );
+        string_append ( expected_pad , " }" , 2 );
+        string = string_format ( "%A[{|\\||}]u" , u16_array_in );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_u16 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_u16 , string_length ( string ) ) );
+        string_destroy ( string );
+        string = string_format ( "%A[<|\\[, \\]|>]i" , i64_array_in );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_i64 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_i64 , string_length ( string ) ) );
+        string_destroy ( string );
+        string = string_format ( "%Pl 5000[:3]Ai" , i64_array_in );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_pad ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_pad , string_length ( string ) ) );
+        string_destroy ( string );
+        string_destroy ( expected_u16 );
+        string_destroy ( expected_i64 );
+        string_destroy ( expected_pad );
+        array_destroy ( u16_array_in );
+        array_destroy ( i64_array_in );
+    }
+
+    // TEST 144: Padding format modifiers repeat the padding string correctly for pad widths exceeding any internal buffer, with or without escaped `'` characters.
+    {
+        const char* patterns[ 4 ] = { "#" , "'ab" , "0123456789abcdefghijklmnopqrstuvwxyz'ABCD" , "x'" };
+        const char* formats[ 4 ] = { "%Pl#700u" , "%Pl'\\'ab'700u" , "%Pr'0123456789abcdefghijklmnopqrstuvwxyz\\'ABCD'700u" , "%Pr?700u|%Pr'?'700u" };
+        for ( u64 i = 0; i < 3; ++i )
+        {
+            string = string_format ( formats[ i ] , 7 );
+            EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+            EXPECT_EQ ( 700 , string_length ( string ) );
+            const u64 pattern_length = _string_length ( patterns[ i ] );
+            const u64 offset = ( i == 2 ) ? 1 : 0;
+            if ( i == 2 )
+            {
+                EXPECT_EQ ( '7' , ( u64 )( string[ 0 ] ) );
+            }
+            else
+            {
+                EXPECT_EQ ( '7' , ( u64 )( string[ 699 ] ) );
+            }
+            for ( u64 j = 0; j < 699; ++j )
+            {
+                EXPECT_EQ ( ( u64 )( patterns[ i ][ j % pattern_length ] ) , ( u64 )( string[ offset + j ] ) );
+            }
+            string_destroy ( string );
+        }
+        string = string_format ( formats[ 3 ] , 'x' , 7 , &"x'" , 7 );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( 1401 , string_length ( string ) );
+        EXPECT_EQ ( '7' , ( u64 )( string[ 0 ] ) );
+        EXPECT_EQ ( '|' , ( u64 )( string[ 700 ] ) );
+        EXPECT_EQ ( '7' , ( u64 )( string[ 701 ] ) );
+        for ( u64 j = 0; j < 699; ++j )
+        {
+            EXPECT_EQ ( 'x' , ( u64 )( string[ 1 + j ] ) );
+            EXPECT_EQ ( ( u64 )( patterns[ 3 ][ j % 2 ] ) , ( u64 )( string[ 702 + j ] ) );
+        }
+        string_destroy ( string );
+    }
+
+    // TEST 145: Fix-precision format modifier without a precision prints the shortest round-trip representation.
+    float_in = -100098.7893573;
+    string = string_format ( "%.f|%.F|%.e|%.d|%+.f" , &float_in , &float_in , &float_in , &float_in , &float_in );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "-100098.7893573|-100098.7893573|-1.000987893573E5|7893573|-100098.7893573" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "-100098.7893573|-100098.7893573|-1.000987893573E5|7893573|-100098.7893573" , string_length ( string ) ) );
+    string_destroy ( string );
+    float_in = 100.0;
+    string = string_format ( "%.f|%.F|%.e|%.d|%+.f" , &float_in , &float_in , &float_in , &float_in , &float_in );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "100|100.0|1E2|0|+100" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "100|100.0|1E2|0|+100" , string_length ( string ) ) );
+    string_destroy ( string );
+
+    // TEST 146: Bytesize format specifier, with SI-units format modifier and units larger than GiB.
+    string = string_format ( "%k.2size | %k.2size | %k.2size | %k.2size | %k.2size | %k.2size | %k.2size" , KB ( 1 ) - 1 , KB ( 1 ) , MB ( 1 ) - 1 , MiB ( 1 ) , GiB ( 1 ) , GB ( 1000 ) , 18446744073709551615U );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "999 B | 1 kB | 1000.00 kB | 1.05 MB | 1.07 GB | 1 TB | 18.45 EB" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "999 B | 1 kB | 1000.00 kB | 1.05 MB | 1.07 GB | 1 TB | 18.45 EB" , string_length ( string ) ) );
+    string_destroy ( string );
+    string = string_format ( "%.2size | %.2size | %.2size | %+.size | %k.size" , GiB ( 1024 ) , GiB ( 1024 ) * 1536 , 18446744073709551615U , 1536 , 1500 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "1 TiB | 1.50 PiB | 16.00 EiB | +1.5 KiB | 1.5 kB" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "1 TiB | 1.50 PiB | 16.00 EiB | +1.5 KiB | 1.5 kB" , string_length ( string ) ) );
+    string_destroy ( string );
+
+    // TEST 147: Typed variadic argument list passes f64 and f32 by value, alongside integers, addresses, and floating point numbers passed by address.
+    {
+        const f64 f64_in = -100098.7893573;
+        const f32 f32_in = 1.5f;
+        string = _string_format ( "%.f|%F|%.2e|%i|%s|%.f|%u|%.d"
+                                , TYPED_ARGS ( f64_in , f32_in , 1E21 , -42 , "text" , &f64_in , 7 , 0.25 )
+                                );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( _string_length ( "-100098.7893573|1.500000|1.00E21|-42|text|-100098.7893573|7|25" ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , "-100098.7893573|1.500000|1.00E21|-42|text|-100098.7893573|7|25" , string_length ( string ) ) );
+        string_destroy ( string );
+    }
+
+    // TEST 148: Collection format modifiers print integer arrays whose separator is longer than the internal staging buffer, whether the separator is passed by wildcard or inline.
+    {
+        const u32 u32_array_in[] = { 1 , 22 , 333 , 4444 };
+        const i16 i16_array_in[] = { -1 , 22 , -333 , 4444 };
+        const u64 u64_array_in[] = { 1 , 22 , 18446744073709551615ULL , 4444 };
+        const i64 i64_array_in[] = { -1 , 22 , -9223372036854775807LL , 4444 };
+        char* separator = string_create ();
+        EXPECT_NEQ ( 0 , separator ); // Verify there was no memory error prior to the test.
+        for ( u64 i = 0; i < 6000; ++i )
+        {
+            string_append ( separator , ( i % 2 ) ? "-" : "=" , 1 );
+        }
+        char* format = string_create_from ( "%a[|" );
+        char* expected_u32 = string_create ();
+        char* expected_i16 = string_create ();
+        char* expected_u64 = string_create ();
+        char* expected_i64 = string_create ();
+        EXPECT_NEQ ( 0 , format ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_u32 ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_i16 ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_u64 ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected_i64 ); // Verify there was no memory error prior to the test.
+        _string_append ( format , separator );
+        string_append ( format , "|]i" , 3 );
+        for ( u64 i = 0; i < 4; ++i )
+        {
+            if ( i )
+            {
+                _string_append ( expected_u32 , separator );
+                _string_append ( expected_i16 , separator );
+                _string_append ( expected_u64 , separator );
+                _string_append ( expected_i64 , separator );
+            }
+            string = string_format ( "%u" , u32_array_in[ i ] );
+            _string_append ( expected_u32 , string );
+            string_destroy ( string );
+            string = string_format ( "%i" , i16_array_in[ i ] );
+            _string_append ( expected_i16 , string );
+            string_destroy ( string );
+            string = string_format ( "%u" , u64_array_in[ i ] );
+            _string_append ( expected_u64 , string );
+            string_destroy ( string );
+            string = string_format ( "%i" , i64_array_in[ i ] );
+            _string_append ( expected_i64 , string );
+            string_destroy ( string );
+        }
+        string = string_format ( "%a[|?|]u" , u32_array_in , 4 , sizeof ( u32 ) , separator );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_u32 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_u32 , string_length ( string ) ) );
+        string_destroy ( string );
+        string = string_format ( format , i16_array_in , 4 , sizeof ( i16 ) );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_i16 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_i16 , string_length ( string ) ) );
+        string_destroy ( string );
+        string = string_format ( "%a[|?|]u" , u64_array_in , 4 , sizeof ( u64 ) , separator );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_u64 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_u64 , string_length ( string ) ) );
+        string_destroy ( string );
+        string = string_format ( format , i64_array_in , 4 , sizeof ( i64 ) );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected_i64 ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected_i64 , string_length ( string ) ) );
+        string_destroy ( string );
+        string_destroy ( separator );
+        string_destroy ( format );
+        string_destroy ( expected_u32 );
+        string_destroy ( expected_i16 );
+        string_destroy ( expected_u64 );
+        string_destroy ( expected_i64 );
+    }
+
     // TODO: Add support for passing a single backslash as a multi-character
     //       padding string. Currently, this does not work because the
     //       terminating delimiter matches against its escape sequence
@@ -3637,6 +4480,732 @@ test_string_format
     return true;
 }
 
+u8
+test_string_format_exact
+( void )
+{
+    const i32 const_i32_array_in[ 6 ] = { -3 , -2 , -1 , 0 , 1 , 2 };
+    const char* const_string_array_in[ 4 ] = { "Hello" , " " , "world" , "!" };
+    i32* i32_array_in = array_create_from ( i32 , const_i32_array_in , 6 );
+    char* string_in = string_create_from ( "Hello world!" );
+    f64 float_in = -3.14159;
+    char* string;
+    char* expected;
+
+    // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , i32_array_in );
+    EXPECT_NEQ ( 0 , string_in );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_exact logs an error and returns an empty string if no format string is supplied.
+    string = string_format_exact ( 0 , 1 , 2 , 3 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    EXPECT_EQ ( 0 , *string );
+    string_destroy ( string );
+
+    // TEST 2: string_format_exact produces the same output as string_format, with a single allocation of exactly the output length.
+    #define TEST_STRING_FORMAT_EXACT(...)                                              \
+        string = string_format_exact ( __VA_ARGS__ );                                  \
+        expected = string_format ( __VA_ARGS__ );                                      \
+        EXPECT_NEQ ( 0 , string ); /* Verify there was no memory error prior to the test. */   \
+        EXPECT_NEQ ( 0 , expected ); /* Verify there was no memory error prior to the test. */ \
+        EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );          \
+        EXPECT_EQ ( string_length ( string ) + 1 , array_capacity ( string ) );       \
+        EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) ); \
+        string_destroy ( string );                                                     \
+        string_destroy ( expected );
+    TEST_STRING_FORMAT_EXACT ( "" );
+    TEST_STRING_FORMAT_EXACT ( "No format specifiers, 100%%." );
+    TEST_STRING_FORMAT_EXACT ( "%u %i %@ %c %B %b %size" , 12345 , -12345 , 0xFF , 'x' , true , false , 4096 );
+    TEST_STRING_FORMAT_EXACT ( "%f|%.2F|%+e|%-d" , &float_in , &float_in , &float_in , &float_in );
+    TEST_STRING_FORMAT_EXACT ( "%Pl*12s|%Pr'-\\''7u|%P??5i|%pl 3u" , const_string_array_in[ 0 ] , 42 , &"r" , '#' , -1 , 1000 );
+    TEST_STRING_FORMAT_EXACT ( "%S|%[6:11]S|%s" , string_in , string_in , const_string_array_in[ 2 ] );
+    TEST_STRING_FORMAT_EXACT ( "%Ai|%a[\\[|\\|, |\\]]i|%a[?|?|?]s|%[1:4]Ai" , i32_array_in , const_i32_array_in , 6 , sizeof ( i32 ) , const_string_array_in , 4 , sizeof ( char* ) , &"<" , &", " , &">" , i32_array_in );
+    TEST_STRING_FORMAT_EXACT ( "%Pl_20{%u, %s}, %Pr 8{\\{%i\\}}" , 7 , &"nested" , -7 );
+    TEST_STRING_FORMAT_EXACT ( "50% of %u is %i%" , 10 , 20 , 5 );
+    TEST_STRING_FORMAT_EXACT ( "%u %s %u" , 1 );
+    #undef TEST_STRING_FORMAT_EXACT
+
+    // TEST 3: string_format_exact is compatible with the format string cache, and each call accesses the cache once.
+    EXPECT ( string_format_cache_startup ( 1 , 0 , 0 ) );
+    for ( u64 i = 0; i < 2; ++i )
+    {
+        string_format_cache_stats_t stats;
+        string = string_format_exact ( "%Pl 4u:%a[(|, |)]i" , i , const_i32_array_in , 6 , sizeof ( i32 ) );
+        EXPECT ( string_format_cache_stats ( &stats ) );
+        EXPECT_EQ ( 1 , stats.misses );
+        EXPECT_EQ ( i , stats.hits );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( _string_length ( "   0:(-3, -2, -1, 0, 1, 2)" ) , string_length ( string ) );
+        EXPECT_EQ ( string_length ( string ) + 1 , array_capacity ( string ) );
+        EXPECT_EQ ( '0' + i , ( u64 )( string[ 3 ] ) );
+        EXPECT ( memory_equal ( string + 4 , ":(-3, -2, -1, 0, 1, 2)" , string_length ( string ) - 4 ) );
+        string_destroy ( string );
+    }
+    EXPECT ( string_format_cache_shutdown () );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    array_destroy ( i32_array_in );
+    string_destroy ( string_in );
+
+    return true;
+}
+
+u8
+test_string_format_into
+( void )
+{
+    const i32 const_i32_array_in[ 6 ] = { -3 , -2 , -1 , 0 , 1 , 2 };
+    char buffer[ 64 ];
+    char* expected;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_into logs an error, writes an empty string and returns 0 if no format string is supplied.
+    buffer[ 0 ] = '#';
+    EXPECT_EQ ( 0 , string_format_into ( buffer , sizeof ( buffer ) , 0 , 1 , 2 , 3 ) );
+    EXPECT_EQ ( 0 , buffer[ 0 ] );
+
+    // TEST 2: string_format_into logs an error and returns 0 if no output buffer is supplied with a non-zero capacity.
+    EXPECT_EQ ( 0 , string_format_into ( 0 , sizeof ( buffer ) , "%u" , 1 ) );
+
+    // TEST 3: string_format_into writes the formatted string if it fits.
+    expected = string_format ( "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) );
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_format_into ( buffer , sizeof ( buffer ) , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( string_length ( expected ) , _string_length ( buffer ) );
+    EXPECT ( memory_equal ( buffer , expected , string_length ( expected ) + 1 ) );
+
+    // TEST 4: string_format_into truncates the formatted string if it does not fit, and returns the required length.
+    memory_set ( buffer , '#' , sizeof ( buffer ) );
+    EXPECT_EQ ( string_length ( expected ) , string_format_into ( buffer , 10 , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( 9 , _string_length ( buffer ) );
+    EXPECT ( memory_equal ( buffer , expected , 9 ) );
+    EXPECT_EQ ( '#' , buffer[ 10 ] );
+    memory_set ( buffer , '#' , sizeof ( buffer ) );
+    EXPECT_EQ ( 0 , string_format_into ( buffer , 1 , "" ) );
+    EXPECT_EQ ( 0 , buffer[ 0 ] );
+    EXPECT_EQ ( '#' , buffer[ 1 ] );
+
+    // TEST 5: string_format_into only computes the required length if the capacity is 0.
+    EXPECT_EQ ( string_length ( expected ) , string_format_into ( 0 , 0 , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( '#' , buffer[ 1 ] );
+    string_destroy ( expected );
+
+    // TEST 6: string_format_into is compatible with nested format substrings and the format string cache.
+    EXPECT ( string_format_cache_startup ( 1 , 0 , 0 ) );
+    for ( u64 i = 0; i < 2; ++i )
+    {
+        EXPECT_EQ ( _string_length ( "[{0}|x]" ) , string_format_into ( buffer , sizeof ( buffer ) , "[%{\\{%u\\}|%c}]" , i , 'x' ) );
+        EXPECT ( memory_equal ( buffer , "[{" , 2 ) );
+        EXPECT_EQ ( '0' + i , ( u64 )( buffer[ 2 ] ) );
+        EXPECT ( memory_equal ( buffer + 3 , "}|x]" , sizeof ( "}|x]" ) ) );
+    }
+    EXPECT ( string_format_cache_shutdown () );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_format_to
+( void )
+{
+    const i32 const_i32_array_in[ 6 ] = { -3 , -2 , -1 , 0 , 1 , 2 };
+    string_format_sink_t sink;
+    char buffer[ 64 ];
+    char* expected;
+    char* string;
+    i32* i32_array_in;
+    file_t file;
+    u8* file_content;
+    u64 file_content_length;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_to logs an error and returns 0 if no sink is supplied.
+    EXPECT_EQ ( 0 , string_format_to ( 0 , "%u" , 1 ) );
+
+    // TEST 2: string_format_to logs an error and returns 0 if no format string is supplied.
+    string_format_sink_buffer ( &sink , buffer , sizeof ( buffer ) );
+    EXPECT_EQ ( 0 , string_format_to ( &sink , 0 , 1 , 2 , 3 ) );
+    EXPECT_EQ ( 0 , sink.length );
+
+    // TEST 3: string_format_to appends to an existing string when writing to a string sink.
+    expected = string_format ( "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) );
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    string = string_create_from ( "prefix:" );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    string_format_sink_string ( &sink , string );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "%s" , expected ) );
+    EXPECT_EQ ( 2 * string_length ( expected ) , sink.length );
+    string = sink.string;
+    EXPECT_EQ ( _string_length ( "prefix:" ) + 2 * string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "prefix:" , _string_length ( "prefix:" ) ) );
+    EXPECT ( memory_equal ( string + _string_length ( "prefix:" ) , expected , string_length ( expected ) ) );
+    EXPECT ( memory_equal ( string + _string_length ( "prefix:" ) + string_length ( expected ) , expected , string_length ( expected ) ) );
+    string_destroy ( string );
+
+    // TEST 4: string_format_to truncates the output when writing to a buffer sink, but still counts every character.
+    memory_set ( buffer , '#' , sizeof ( buffer ) );
+    string_format_sink_buffer ( &sink , buffer , 10 );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( string_length ( expected ) , sink.length );
+    EXPECT ( memory_equal ( buffer , expected , 10 ) );
+    EXPECT_EQ ( '#' , buffer[ 10 ] );
+    string_format_sink_buffer ( &sink , 0 , 0 );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "%Pl 4u:%a[(|, |)]i 100%%" , 42 , const_i32_array_in , 6 , sizeof ( i32 ) ) );
+    EXPECT_EQ ( string_length ( expected ) , sink.length );
+    EXPECT ( string_format_sink_flush ( &sink ) );
+    string_destroy ( expected );
+
+    // TEST 5: string_format_to writes output longer than the sink buffer to a file.
+    i32_array_in = array_create_from ( i32 , const_i32_array_in , 6 );
+    EXPECT_NEQ ( 0 , i32_array_in ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        array_push ( i32_array_in , i );
+    }
+    expected = string_format ( "%{[%a[(|, |)]i]}%Pr=5000s" , i32_array_in , array_length ( i32_array_in ) , sizeof ( i32 ) , &"end" );
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT ( string_length ( expected ) > STRING_FORMAT_SINK_FILE_BUFFER_SIZE );
+    EXPECT ( file_open ( "test/assets/out-file" , FILE_MODE_WRITE , &file ) );
+    string_format_sink_file ( &sink , &file );
+    EXPECT_EQ ( 3 , string_format_to ( &sink , "%s" , &"end" ) );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "%{[%a[(|, |)]i]}%Pr=5000s" , i32_array_in , array_length ( i32_array_in ) , sizeof ( i32 ) , &"end" ) );
+    EXPECT_EQ ( 3 + string_length ( expected ) , sink.length );
+    EXPECT ( string_format_sink_flush ( &sink ) );
+    file_close ( &file );
+    EXPECT ( file_open ( "test/assets/out-file" , FILE_MODE_READ , &file ) );
+    EXPECT ( file_read_all ( &file , &file_content , &file_content_length ) );
+    file_close ( &file );
+    EXPECT_EQ ( 3 + string_length ( expected ) , file_content_length );
+    EXPECT ( memory_equal ( file_content , "end" , 3 ) );
+    EXPECT ( memory_equal ( file_content + 3 , expected , string_length ( expected ) ) );
+    string_free ( file_content );
+    string_destroy ( expected );
+    array_destroy ( i32_array_in );
+
+    // TEST 6: string_format_to renders padded nested format substrings the same way regardless of sink.
+    expected = string_format ( "[%Pl'-='12{%Pr.6{%u}|%Pl 3{x}}|%Pr*8{ab%{\\{%c\\}}cd}|%Pl 4{toolong}]" , 42 , 'z' );
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "[-=42....|  x|ab{z}cd*|tool]" ) , string_length ( expected ) );
+    EXPECT ( memory_equal ( expected , "[-=42....|  x|ab{z}cd*|tool]" , string_length ( expected ) ) );
+    for ( u64 i = 0; i <= string_length ( expected ); ++i )
+    {
+        memory_set ( buffer , '#' , sizeof ( buffer ) );
+        string_format_sink_buffer ( &sink , buffer , i );
+        EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "[%Pl'-='12{%Pr.6{%u}|%Pl 3{x}}|%Pr*8{ab%{\\{%c\\}}cd}|%Pl 4{toolong}]" , 42 , 'z' ) );
+        EXPECT ( memory_equal ( buffer , expected , i ) );
+        EXPECT_EQ ( '#' , buffer[ i ] );
+    }
+    EXPECT ( file_open ( "test/assets/out-file" , FILE_MODE_WRITE , &file ) );
+    string_format_sink_file ( &sink , &file );
+    EXPECT_EQ ( string_length ( expected ) , string_format_to ( &sink , "[%Pl'-='12{%Pr.6{%u}|%Pl 3{x}}|%Pr*8{ab%{\\{%c\\}}cd}|%Pl 4{toolong}]" , 42 , 'z' ) );
+    EXPECT ( string_format_sink_flush ( &sink ) );
+    file_close ( &file );
+    EXPECT ( file_open ( "test/assets/out-file" , FILE_MODE_READ , &file ) );
+    EXPECT ( file_read_all ( &file , &file_content , &file_content_length ) );
+    file_close ( &file );
+    EXPECT_EQ ( string_length ( expected ) , file_content_length );
+    EXPECT ( memory_equal ( file_content , expected , string_length ( expected ) ) );
+    string_free ( file_content );
+    string_destroy ( expected );
+
+    // Empty the output file.
+    EXPECT ( file_open ( "test/assets/out-file" , FILE_MODE_WRITE , &file ) );
+    file_close ( &file );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_format_append
+( void )
+{
+    char* string;
+    char* expected;
+    char* line;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_append logs an error and returns 0 if no string or format string is supplied.
+    EXPECT_EQ ( 0 , _string_format_append ( 0 , "%u" , ARGS ( 1 ) ) );
+    string = string_create ();
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_format_append ( string , 0 , 1 ) );
+    EXPECT_EQ ( 0 , string_length ( string ) );
+
+    // TEST 2: string_format_append appends to an existing string, growing it as needed, and matches string_format line by line.
+    expected = string_create ();
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        const f64 value = i * 0.25;
+        EXPECT_EQ ( string_length ( string ) , string_length ( expected ) );
+        line = string_format ( "%Pl 4u | %.2f | %s\n" , i , &value , ( i % 2 ) ? "odd" : "even" );
+        EXPECT_NEQ ( 0 , line ); // Verify there was no memory error prior to the test.
+        _string_append ( expected , line );
+        EXPECT_EQ ( string_length ( line ) , string_format_append ( string , "%Pl 4u | %.2f | %s\n" , i , &value , ( i % 2 ) ? "odd" : "even" ) );
+        string_destroy ( line );
+    }
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_format_rows
+( void )
+{
+    char* string;
+    char* expected;
+    char* line;
+    arg_t rows[ 1000 * 3 ];
+    f64 values[ 1000 ];
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_rows logs an error and returns an empty string if no format string or argument table is supplied.
+    string = string_format_rows ( 0 , rows , 1 , 3 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    string_destroy ( string );
+    string = string_format_rows ( "%u" , 0 , 1 , 1 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    string_destroy ( string );
+
+    // TEST 2: string_format_rows renders the format string once per row (no rows yields an empty string).
+    string = string_format_rows ( "%u\n" , rows , 0 , 1 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    string_destroy ( string );
+    string = string_format_rows ( "row\n" , 0 , 3 , 0 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "row\nrow\nrow\n" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "row\nrow\nrow\n" , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+
+    // TEST 3: string_format_rows matches the concatenation of string_format for every row.
+    expected = string_create ();
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        values[ i ] = i * 0.25;
+        rows[ 3 * i + 0 ] = ( arg_t ) i;
+        rows[ 3 * i + 1 ] = ( arg_t )( &values[ i ] );
+        rows[ 3 * i + 2 ] = ( arg_t )( ( i % 2 ) ? "odd" : "even" );
+        line = string_format ( "%Pl 4u | %.2f | %s\n" , i , &values[ i ] , ( i % 2 ) ? "odd" : "even" );
+        EXPECT_NEQ ( 0 , line ); // Verify there was no memory error prior to the test.
+        _string_append ( expected , line );
+        string_destroy ( line );
+    }
+    string = string_format_rows ( "%Pl 4u | %.2f | %s\n" , rows , 1000 , 3 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_builder
+( void )
+{
+    string_builder_t builder;
+    string_format_sink_t sink;
+    char* string;
+    char* expected;
+    char* line;
+    u64 length;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: An empty string builder has 0 length, no chunks, and flattens to an empty string.
+    string_builder_create ( &builder , 7 );
+    EXPECT_EQ ( 0 , string_builder_length ( &builder ) );
+    EXPECT_EQ ( 0 , builder.head );
+    string = string_builder_flatten ( &builder );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    EXPECT_EQ ( 0 , *string );
+    string_destroy ( string );
+
+    // TEST 2: string_builder_append splits content across fixed-capacity chunks, which iterate back to the original content.
+    expected = string_create ();
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 100; ++i )
+    {
+        line = string_format ( "%u: Hello world!\n" , i );
+        EXPECT_NEQ ( 0 , line ); // Verify there was no memory error prior to the test.
+        _string_append ( expected , line );
+        _string_builder_append ( &builder , line );
+        string_destroy ( line );
+        EXPECT_EQ ( string_length ( expected ) , string_builder_length ( &builder ) );
+    }
+    length = 0;
+    for ( const string_builder_chunk_t* chunk = builder.head
+        ; chunk
+        ; chunk = chunk->next
+        )
+    {
+        EXPECT ( chunk->length <= 7 );
+        EXPECT ( chunk->next || builder.tail == chunk );
+        EXPECT ( memory_equal ( chunk->data , expected + length , chunk->length ) );
+        length += chunk->length;
+    }
+    EXPECT_EQ ( string_length ( expected ) , length );
+
+    // TEST 3: string_builder_flatten copies the content into a single resizable string.
+    string = string_builder_flatten ( &builder );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+
+    // TEST 4: string_builder_clear empties the builder, keeping only its first chunk.
+    string_builder_clear ( &builder );
+    EXPECT_EQ ( 0 , string_builder_length ( &builder ) );
+    EXPECT_NEQ ( 0 , builder.head );
+    EXPECT_EQ ( builder.head , builder.tail );
+    EXPECT_EQ ( 0 , builder.head->length );
+    string_builder_destroy ( &builder );
+    EXPECT_EQ ( 0 , builder.head );
+
+    // TEST 5: A string builder sink matches string_format, including padded nested format substrings.
+    string_builder_create ( &builder , 0 );
+    string_format_sink_builder ( &sink , &builder );
+    expected = string_create ();
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    for ( u64 i = 0; i < 1000; ++i )
+    {
+        line = string_format ( "%Pl 4u | %Pr.12{%u:%u} | %pl-6{%s}\n" , i , i * i , i % 7 , ( i % 2 ) ? "odd" : "even" );
+        EXPECT_NEQ ( 0 , line ); // Verify there was no memory error prior to the test.
+        _string_append ( expected , line );
+        EXPECT_EQ ( string_length ( line ) , string_format_to ( &sink , "%Pl 4u | %Pr.12{%u:%u} | %pl-6{%s}\n" , i , i * i , i % 7 , ( i % 2 ) ? "odd" : "even" ) );
+        string_destroy ( line );
+    }
+    EXPECT_EQ ( string_length ( expected ) , string_builder_length ( &builder ) );
+    string = string_builder_flatten ( &builder );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT ( memory_equal ( string , expected , string_length ( expected ) + 1 ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+    string_builder_clear ( &builder );
+
+    // TEST 6: The logger subsystem appends the plaintext of each log message to a string builder.
+    EXPECT ( logger_builder_set ( &builder ) );
+    LOGINFO ( "Logging to a string builder: %u, %s." , 42 , "Hello world!" );
+    EXPECT ( logger_builder_set ( 0 ) );
+    LOGINFO ( "Not logging to a string builder." );
+    string = string_builder_flatten ( &builder );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( LOG_LEVEL_PREFIX_INFO "Logging to a string builder: 42, Hello world!.\n" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , LOG_LEVEL_PREFIX_INFO "Logging to a string builder: 42, Hello world!.\n" , string_length ( string ) + 1 ) );
+    string_destroy ( string );
+    string_builder_destroy ( &builder );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
+u8
+test_string_format_compile
+( void )
+{
+    const i8 const_i8_array_in[ 8 ] = { -4 , -3 , -2 , -1 , 0 , 1 , 2 , 3 };
+    const char* const_string_array_in[ 4 ] = { "Hello" , " " , "world" , "!" };
+    i8* i8_array_in = array_create_from ( i8 , const_i8_array_in , 8 );
+    char* string_in = string_create_from ( "Hello world!" );
+    string_format_program_t* program;
+    char* string;
+    char* expected;
+
+    // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , i8_array_in );
+    EXPECT_NEQ ( 0 , string_in );
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+
+    // TEST 1: string_format_compile logs an error and returns 0 if no format string is supplied.
+    EXPECT_EQ ( 0 , string_format_compile ( 0 ) );
+
+    // TEST 2: string_format_execute logs an error and returns an empty string if no program is supplied.
+    string = string_format_execute ( 0 , 1 , 2 , 3 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( 0 , string_length ( string ) );
+    EXPECT_EQ ( 0 , *string );
+    string_destroy ( string );
+
+    // TEST 3: A compiled format string may be executed any number of times, with different arguments.
+    program = string_format_compile ( "Value: %u (%Pl010u) [%s] 100%%" );
+    EXPECT_NEQ ( 0 , program ); // Verify there was no memory error prior to the test.
+    string = string_format_execute ( program , 0 , 0 , const_string_array_in[ 0 ] );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "Value: 0 (0000000000) [Hello] 100%" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "Value: 0 (0000000000) [Hello] 100%" , string_length ( string ) ) );
+    string_destroy ( string );
+    for ( u64 i = 1; i < 4; ++i )
+    {
+        string = string_format_execute ( program , i * 1000 , i * 7 , const_string_array_in[ i ] );
+        expected = string_format ( "Value: %u (%Pl010u) [%s] 100%%" , i * 1000 , i * 7 , const_string_array_in[ i ] );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , expected , string_length ( string ) ) );
+        string_destroy ( string );
+        string_destroy ( expected );
+    }
+    string_format_program_destroy ( program );
+
+    // TEST 4: Collections (and slices thereof) are resolved from the argument list at execution time.
+    program = string_format_compile ( "%[6:]S|%[1:3]s|%a[(|, |)]i|%[2:5]Ai" );
+    EXPECT_NEQ ( 0 , program ); // Verify there was no memory error prior to the test.
+    string = string_format_execute ( program , string_in , const_string_array_in[ 2 ] , const_i8_array_in , 3 , sizeof ( i8 ) , i8_array_in );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "world!|or|(-4, -3, -2)|{ -2, -1, 0 }" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "world!|or|(-4, -3, -2)|{ -2, -1, 0 }" , string_length ( string ) ) );
+    string_destroy ( string );
+    string_format_program_destroy ( program );
+
+    // TEST 5: Format specifiers with wildcards are validated against the argument list at execution time.
+    program = string_format_compile ( "%P???u|%.?f|%r?u" );
+    EXPECT_NEQ ( 0 , program ); // Verify there was no memory error prior to the test.
+    f64 float_in = 3.14159;
+    string = string_format_execute ( program , &"r" , '*' , 6 , 42 , 2 , &float_in , 16 , 255 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "42****|3.14|FF" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "42****|3.14|FF" , string_length ( string ) ) );
+    string_destroy ( string );
+    string = string_format_execute ( program , &"l" , '-' , 4 , 7 , 1 , &float_in , 2 , 5 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "---7|3.1|101" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "---7|3.1|101" , string_length ( string ) ) );
+    string_destroy ( string );
+    string_format_program_destroy ( program );
+
+    // TEST 6: A format specifier invalidated by the argument list is handled the same way as by string_format.
+    program = string_format_compile ( "%u %s %P?-3u %[4:]s %u %{%u\\}}" );
+    EXPECT_NEQ ( 0 , program ); // Verify there was no memory error prior to the test.
+    string = string_format_execute ( program , 1 , &"two" , &"x" , 3 , &"abc" , 5 );
+    expected = string_format ( "%u %s %P?-3u %[4:]s %u %{%u\\}}" , 1 , &"two" , &"x" , 3 , &"abc" , 5 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+    string = string_format_execute ( program , 1 );
+    expected = string_format ( "%u %s %P?-3u %[4:]s %u %{%u\\}}" , 1 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+    string_format_program_destroy ( program );
+
+    // TEST 7: A format string which is invalid regardless of the argument list.
+    program = string_format_compile ( "50% of %u is %i%" );
+    EXPECT_NEQ ( 0 , program ); // Verify there was no memory error prior to the test.
+    string = string_format_execute ( program , 10 , 20 , 5 );
+    expected = string_format ( "50% of %u is %i%" , 10 , 20 , 5 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_NEQ ( 0 , expected ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( string_length ( expected ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , expected , string_length ( string ) ) );
+    string_destroy ( string );
+    string_destroy ( expected );
+    string_format_program_destroy ( program );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    array_destroy ( i8_array_in );
+    string_destroy ( string_in );
+
+    return true;
+}
+
+u8
+test_string_format_cache
+( void )
+{
+    string_format_cache_stats_t stats;
+    char buffer[ 16 ];
+    char formats[ 10 ][ 4 ];
+    u64 memory_requirement;
+    char* string;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Start test.
+
+    // TEST 1: string_format_cache_stats returns false and zeroes the statistics if the cache is not running.
+    memory_set ( &stats , 0xFF , sizeof ( stats ) );
+    EXPECT_NOT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 0 , stats.capacity );
+    EXPECT_EQ ( 0 , stats.count );
+    EXPECT_EQ ( 0 , stats.hits );
+    EXPECT_EQ ( 0 , stats.misses );
+    EXPECT_EQ ( 0 , stats.evictions );
+
+    // TEST 2: string_format_cache_startup reports its memory requirement without starting the cache if no memory is supplied.
+    memory_requirement = 0;
+    EXPECT ( string_format_cache_startup ( 20 , &memory_requirement , 0 ) );
+    EXPECT_NEQ ( 0 , memory_requirement );
+    EXPECT_NOT ( string_format_cache_stats ( &stats ) );
+
+    // TEST 3: string_format_cache_startup rounds the capacity up to a power of two multiple of the cache set size.
+    EXPECT ( string_format_cache_startup ( 20 , 0 , 0 ) );
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 32 , stats.capacity );
+    EXPECT_EQ ( 0 , stats.count );
+
+    // TEST 4: Formatting with the same format string more than once hits the cache.
+    for ( u64 i = 0; i < 4; ++i )
+    {
+        string = string_format ( "(%u)" , i );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( 3 , string_length ( string ) );
+        EXPECT_EQ ( '0' + i , ( u64 )( string[ 1 ] ) );
+        string_destroy ( string );
+    }
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 1 , stats.count );
+    EXPECT_EQ ( 3 , stats.hits );
+    EXPECT_EQ ( 1 , stats.misses );
+    EXPECT_EQ ( 0 , stats.evictions );
+
+    // TEST 5: A format string whose address is reused with different contents is recompiled.
+    memory_copy ( buffer , "[%u]" , sizeof ( "[%u]" ) );
+    string = string_format ( buffer , 7 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "[7]" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "[7]" , string_length ( string ) ) );
+    string_destroy ( string );
+    memory_copy ( buffer , "<%i>" , sizeof ( "<%i>" ) );
+    string = string_format ( buffer , -7 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    EXPECT_EQ ( _string_length ( "<-7>" ) , string_length ( string ) );
+    EXPECT ( memory_equal ( string , "<-7>" , string_length ( string ) ) );
+    string_destroy ( string );
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 2 , stats.count );
+    EXPECT_EQ ( 3 , stats.hits );
+    EXPECT_EQ ( 3 , stats.misses );
+    EXPECT_EQ ( 0 , stats.evictions );
+
+    // TEST 6: string_format_cache_startup logs an error and fails if the cache is already running.
+    LOGWARN ( "The following errors are intentionally triggered by a test:" );
+    EXPECT_NOT ( string_format_cache_startup ( 20 , 0 , 0 ) );
+    EXPECT ( string_format_cache_shutdown () );
+    EXPECT_NOT ( string_format_cache_stats ( &stats ) );
+
+    // TEST 7: The cache is bounded; the least-recently used format strings are evicted.
+    EXPECT ( string_format_cache_startup ( 1 , 0 , 0 ) );
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 8 , stats.capacity );
+    for ( u64 i = 0; i < 10; ++i )
+    {
+        formats[ i ][ 0 ] = 'a' + i;
+        memory_copy ( formats[ i ] + 1 , "%u" , sizeof ( "%u" ) );
+    }
+    for ( u64 i = 0; i < 2; ++i )
+    {
+        for ( u64 j = 0; j < 10; ++j )
+        {
+            string = string_format ( formats[ j ] , j );
+            EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+            EXPECT_EQ ( 2 , string_length ( string ) );
+            EXPECT_EQ ( 'a' + j , ( u64 )( string[ 0 ] ) );
+            EXPECT_EQ ( '0' + j , ( u64 )( string[ 1 ] ) );
+            string_destroy ( string );
+        }
+    }
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 8 , stats.count );
+    EXPECT_EQ ( 0 , stats.hits );
+    EXPECT_EQ ( 20 , stats.misses );
+    EXPECT_EQ ( 12 , stats.evictions );
+    string = string_format ( formats[ 9 ] , 9 );
+    EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+    string_destroy ( string );
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 1 , stats.hits );
+    EXPECT ( string_format_cache_shutdown () );
+
+    // TEST 8: The cache may be started with caller-supplied memory.
+    EXPECT ( string_format_cache_startup ( 4 , &memory_requirement , 0 ) );
+    void* memory = memory_allocate ( memory_requirement );
+    EXPECT_NEQ ( 0 , memory ); // Verify there was no memory error prior to the test.
+    EXPECT ( string_format_cache_startup ( 4 , &memory_requirement , memory ) );
+    for ( u64 i = 0; i < 2; ++i )
+    {
+        string = string_format ( "%s, %s!" , &"Hello" , &"world" );
+        EXPECT_NEQ ( 0 , string ); // Verify there was no memory error prior to the test.
+        EXPECT_EQ ( _string_length ( "Hello, world!" ) , string_length ( string ) );
+        EXPECT ( memory_equal ( string , "Hello, world!" , string_length ( string ) ) );
+        string_destroy ( string );
+    }
+    EXPECT ( string_format_cache_stats ( &stats ) );
+    EXPECT_EQ ( 1 , stats.hits );
+    EXPECT_EQ ( 1 , stats.misses );
+    EXPECT ( string_format_cache_shutdown () );
+    memory_free ( memory );
+
+    // TEST 9: string_format_cache_shutdown succeeds if the cache is not running.
+    EXPECT ( string_format_cache_shutdown () );
+
+    // End test.
+    ////////////////////////////////////////////////////////////////////////////
+
+    return true;
+}
+
 void
 test_register_string
 ( void )
@@ -3646,18 +5215,31 @@ test_register_string
     // test_register ( test_string_append , "Testing string 'push' operation." );
     // test_register ( test_string_insert_and_remove , "Testing string 'insert' and 'remove' operations." );
     // test_register ( test_string_insert_and_remove_random , "Testing string 'insert' and 'remove' operations with random indices and elements." );
+    test_register ( test_string_create_local , "Creating a resizable string in a local buffer." );
+    test_register ( test_string_create_in_arena , "Allocating resizable strings and arrays from an arena." );
     test_register ( test_string_empty , "Detecting an empty string." );
     test_register ( test_string_truncate , "Testing string 'truncate' operation." );
     test_register ( test_string_trim , "Testing string 'trim' operation." );
     test_register ( test_string_contains , "Testing string 'contains' operation." );
     test_register ( test_string_reverse , "Testing string in-place 'reverse' operation." );
     test_register ( test_string_replace , "Testing string 'replace' operation." );
+    test_register ( test_string_replace_multiple , "Testing string 'replace' operation with multiple substrings." );
     test_register ( test_string_strip_ansi , "Stripping a string of ANSI formatting codes." );
     test_register ( test_string_strip_escape , "Stripping a string of escape sequences." );
     test_register ( test_string_u64_and_i64 , "Testing 'stringify' operation on 64-bit integers." );
     test_register ( test_string_f64 , "Testing 'stringify' operation on 64-bit floating point numbers." );
     test_register ( test_to_u64 , "Parsing a string as a u64 value." );
     test_register ( test_to_i64 , "Parsing a string as a i64 value." );
+    test_register ( test_to_u64_and_i64_prefix , "Parsing a u64 or i64 value at the start of a string." );
     test_register ( test_to_f64 , "Parsing a string as a f64 value." );
+    test_register ( test_string_and_to_array , "Stringifying and parsing arrays of 64-bit numbers." );
     test_register ( test_string_format , "Constructing a string using format specifiers." );
+    test_register ( test_string_format_exact , "Constructing a string of exactly the required length using format specifiers." );
+    test_register ( test_string_format_into , "Constructing a string in a fixed-length buffer using format specifiers." );
+    test_register ( test_string_format_to , "Writing a formatted string directly to an output sink." );
+    test_register ( test_string_format_append , "Appending a formatted string to an existing resizable string." );
+    test_register ( test_string_format_rows , "Formatting a table of argument rows with a single format string." );
+    test_register ( test_string_builder , "Building a string in fixed-capacity chunks." );
+    test_register ( test_string_format_compile , "Constructing a string using a compiled format string." );
+    test_register ( test_string_format_cache , "Constructing a string using a cached format string." );
 }
\ No newline at end of file